@@ -0,0 +1,93 @@
+// ============================================================================
+// BenchMain.cpp
+// Point d'entrée des benchmarks (build.py bench)
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "Benchmark.h"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+// Suites de benchmarks
+void RunGridBenchmarks(BenchmarkRunner& runner);
+bool RunCorpusBenchmarks(BenchmarkRunner& runner, const std::string& corpusDir);
+bool RunRenderBenchmarks(BenchmarkRunner& runner, int framesPerRepetition);
+bool RunIoBenchmarks(BenchmarkRunner& runner, const std::string& corpusDir);
+bool RunFingerprintSetBenchmarks(BenchmarkRunner& runner);
+void RunGeneratorBenchmarks(BenchmarkRunner& runner);
+
+int main(int argc, char* argv[])
+{
+    BenchmarkOptions options;
+    std::string jsonPath;
+    std::string corpusDir = "bench/corpus";
+    int renderFrames = 500;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--json=", 7) == 0)
+        {
+            jsonPath = argv[i] + 7;
+        }
+        else if (strncmp(argv[i], "--repetitions=", 14) == 0)
+        {
+            options.repetitions = atoi(argv[i] + 14);
+        }
+        else if (strncmp(argv[i], "--min-time=", 11) == 0)
+        {
+            options.repetitionMs = atof(argv[i] + 11);
+        }
+        else if (strncmp(argv[i], "--warmup=", 9) == 0)
+        {
+            options.warmupMs = atof(argv[i] + 9);
+        }
+        else if (strncmp(argv[i], "--cpu=", 6) == 0)
+        {
+            options.cpu = atoi(argv[i] + 6);
+        }
+        else if (strncmp(argv[i], "--filter=", 9) == 0)
+        {
+            options.filter = argv[i] + 9;
+        }
+        else if (strncmp(argv[i], "--corpus=", 9) == 0)
+        {
+            corpusDir = argv[i] + 9;
+        }
+        else if (strncmp(argv[i], "--frames=", 9) == 0)
+        {
+            renderFrames = atoi(argv[i] + 9);
+        }
+        else
+        {
+            std::cerr << "Option inconnue: " << argv[i] << std::endl;
+            std::cerr << "Usage: " << argv[0]
+                      << " [--json=resultats.json] [--repetitions=N] [--min-time=ms]"
+                      << " [--warmup=ms] [--cpu=N] [--filter=texte]"
+                      << " [--corpus=bench/corpus] [--frames=N]" << std::endl;
+            return 1;
+        }
+    }
+
+    if (options.repetitions < 1)
+        options.repetitions = 1;
+    if (renderFrames < 1)
+        renderFrames = 1;
+
+    BenchmarkRunner runner(options);
+    runner.Start();
+
+    RunGridBenchmarks(runner);
+    bool ok = RunCorpusBenchmarks(runner, corpusDir);
+    ok = RunRenderBenchmarks(runner, renderFrames) && ok;
+    ok = RunIoBenchmarks(runner, corpusDir) && ok;
+    ok = RunFingerprintSetBenchmarks(runner) && ok;
+    RunGeneratorBenchmarks(runner);
+
+    if (!jsonPath.empty() && !runner.WriteJson(jsonPath))
+        return 1;
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,248 @@
+// ============================================================================
+// Benchmark.cpp
+// Implémentation de l'outil de mesure des performances
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "Benchmark.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+// ============================================================================
+// Calcule médiane, p99, minimum et moyenne des échantillons
+// ============================================================================
+void BenchmarkResult::ComputeStats()
+{
+    if (samples.empty())
+        return;
+
+    std::vector<double> sorted(samples);
+    std::sort(sorted.begin(), sorted.end());
+
+    size_t count = sorted.size();
+    median = (count % 2 == 1) ? sorted[count / 2]
+                              : (sorted[count / 2 - 1] + sorted[count / 2]) / 2.0;
+
+    // Rang le plus proche : le plus petit échantillon couvrant 99 %
+    size_t rank = static_cast<size_t>(std::ceil(0.99 * count));
+    p99 = sorted[std::max<size_t>(rank, 1) - 1];
+    min = sorted.front();
+
+    double sum = 0.0;
+    for (double sample : sorted)
+        sum += sample;
+    mean = sum / count;
+}
+
+// ============================================================================
+// Constructeur
+// ============================================================================
+BenchmarkRunner::BenchmarkRunner(const BenchmarkOptions& options)
+    : mOptions(options), mPinnedCpu(-1)
+{
+}
+
+// ============================================================================
+// Fixe le processus sur un cœur et affiche l'en-tête
+// ============================================================================
+void BenchmarkRunner::Start()
+{
+#if defined(__linux__)
+    // Un seul cœur : pas de migration entre mesures (caches, fréquence)
+    int cpu = (mOptions.cpu >= 0) ? mOptions.cpu : sched_getcpu();
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) == 0)
+        mPinnedCpu = cpu;
+    else
+        fprintf(stderr, "[ATTENTION] Impossible de fixer le processus sur le coeur %d\n", cpu);
+#endif
+
+    printf("Repetitions: %d x %.0f ms, chauffe %.0f ms, coeur %d\n\n",
+           mOptions.repetitions, mOptions.repetitionMs, mOptions.warmupMs, mPinnedCpu);
+    printf("%-40s %14s %14s  %s\n", "Benchmark", "Mediane", "p99", "Unite");
+    fflush(stdout);
+}
+
+// ============================================================================
+// Rend tous les cœurs en ligne au thread appelant
+// ============================================================================
+void BenchmarkRunner::ReleaseThreadAffinity()
+{
+#if defined(__linux__)
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (long cpu = 0; cpu < count && cpu < CPU_SETSIZE; cpu++)
+        CPU_SET(cpu, &set);
+    sched_setaffinity(0, sizeof(set), &set);
+#endif
+}
+
+// ============================================================================
+// Vrai si le benchmark passe le filtre
+// ============================================================================
+bool BenchmarkRunner::IsSelected(const std::string& name) const
+{
+    return mOptions.filter.empty() || name.find(mOptions.filter) != std::string::npos;
+}
+
+// ============================================================================
+// Durée d'un appel du corps (ms)
+// ============================================================================
+double BenchmarkRunner::TimeBody(const Body& body, long long iterations)
+{
+    Clock::time_point start = Clock::now();
+    body(iterations);
+    std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+    return elapsed.count();
+}
+
+// ============================================================================
+// Micro-benchmark : calibration, chauffe puis répétitions
+// ============================================================================
+void BenchmarkRunner::Run(const std::string& name, const Body& body)
+{
+    if (!IsSelected(name))
+        return;
+
+    // Calibration : double le nombre d'itérations jusqu'à une durée mesurable
+    long long iterations = 1;
+    double elapsed = TimeBody(body, iterations);
+    while (elapsed < mOptions.repetitionMs / 10.0 && iterations < (1LL << 40))
+    {
+        iterations *= 2;
+        elapsed = TimeBody(body, iterations);
+    }
+    iterations = std::max(1LL, static_cast<long long>(
+        iterations * mOptions.repetitionMs / std::max(elapsed, 1e-6)));
+
+    // Chauffe : caches, prédicteurs de branchement, fréquence du processeur
+    Clock::time_point warmupEnd = Clock::now() +
+        std::chrono::microseconds(static_cast<long long>(mOptions.warmupMs * 1000.0));
+    while (Clock::now() < warmupEnd)
+        body(iterations / 10 + 1);
+
+    BenchmarkResult result;
+    result.name = name;
+    result.unit = "ns/op";
+    result.iterations = iterations;
+
+    for (int i = 0; i < mOptions.repetitions; i++)
+        result.samples.push_back(TimeBody(body, iterations) * 1e6 / iterations);
+
+    AddResult(result);
+}
+
+// ============================================================================
+// Ajoute un résultat et l'affiche
+// ============================================================================
+void BenchmarkRunner::AddResult(BenchmarkResult result)
+{
+    result.ComputeStats();
+
+    printf("%-40s %14.2f %14.2f  %s\n", result.name.c_str(), result.median,
+           result.p99, result.unit.c_str());
+    for (const auto& counter : result.counters)
+        printf("    %-36s %14.2f\n", counter.first.c_str(), counter.second);
+    fflush(stdout);
+
+    mResults.push_back(result);
+}
+
+// ============================================================================
+// Réglages de la session
+// ============================================================================
+const BenchmarkOptions& BenchmarkRunner::GetOptions() const
+{
+    return mOptions;
+}
+
+// ============================================================================
+// Écrit une chaîne JSON (les noms sont en ASCII, seuls " et \ sont échappés)
+// ============================================================================
+static void WriteJsonString(FILE* file, const std::string& text)
+{
+    fputc('"', file);
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+            fputc('\\', file);
+        fputc(c, file);
+    }
+    fputc('"', file);
+}
+
+// ============================================================================
+// Écrit tous les résultats au format JSON
+// ============================================================================
+bool BenchmarkRunner::WriteJson(const std::string& path) const
+{
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file)
+    {
+        fprintf(stderr, "[ERREUR] Impossible d'ecrire %s\n", path.c_str());
+        return false;
+    }
+
+    char host[256] = "inconnu";
+#if defined(__unix__) || defined(__APPLE__)
+    gethostname(host, sizeof(host) - 1);
+#endif
+
+    char date[32];
+    time_t now = time(nullptr);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+    fputs("{\n  \"context\": {\n    \"host\": ", file);
+    WriteJsonString(file, host);
+    fputs(",\n    \"date\": ", file);
+    WriteJsonString(file, date);
+    fputs(",\n    \"compiler\": ", file);
+    WriteJsonString(file, __VERSION__);
+    fprintf(file, ",\n    \"cpu\": %d,\n    \"repetitions\": %d\n  },\n  \"benchmarks\": [",
+            mPinnedCpu, mOptions.repetitions);
+
+    for (size_t i = 0; i < mResults.size(); i++)
+    {
+        const BenchmarkResult& result = mResults[i];
+
+        fputs(i == 0 ? "\n    {\"name\": " : ",\n    {\"name\": ", file);
+        WriteJsonString(file, result.name);
+        fputs(", \"unit\": ", file);
+        WriteJsonString(file, result.unit);
+        fprintf(file, ", \"iterations\": %lld, \"median\": %.4f, \"p99\": %.4f, "
+                      "\"min\": %.4f, \"mean\": %.4f,\n     \"counters\": {",
+                result.iterations, result.median, result.p99, result.min, result.mean);
+
+        for (size_t c = 0; c < result.counters.size(); c++)
+        {
+            if (c > 0)
+                fputs(", ", file);
+            WriteJsonString(file, result.counters[c].first);
+            fprintf(file, ": %.4f", result.counters[c].second);
+        }
+
+        fputs("},\n     \"samples\": [", file);
+        for (size_t s = 0; s < result.samples.size(); s++)
+            fprintf(file, s == 0 ? "%.4f" : ", %.4f", result.samples[s]);
+        fputs("]}", file);
+    }
+
+    fputs("\n  ]\n}\n", file);
+    fclose(file);
+
+    printf("\nResultats ecrits dans %s\n", path.c_str());
+    return true;
+}
@@ -0,0 +1,100 @@
+// ============================================================================
+// Benchmark.h
+// Outil de mesure des performances (répétitions, médiane, p99, JSON)
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Empêche le compilateur de supprimer un calcul dont le résultat est inutilisé
+template <typename T>
+inline void DoNotOptimize(const T& value)
+{
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+// Réglages d'une session de mesure
+struct BenchmarkOptions
+{
+    int repetitions = 20;           // Mesures par benchmark (échantillons)
+    double repetitionMs = 10.0;     // Durée visée d'une mesure
+    double warmupMs = 50.0;         // Exécution non mesurée avant les mesures
+    int cpu = -1;                   // Cœur imposé (-1 = cœur courant)
+    std::string filter;             // Sous-chaîne du nom (vide = tout)
+};
+
+// Résultat d'un benchmark : un échantillon par répétition
+struct BenchmarkResult
+{
+    std::string name;
+    std::string unit;               // Unité des échantillons (ex. "ns/op")
+    long long iterations = 0;       // Opérations par répétition
+    std::vector<double> samples;
+
+    // Statistiques calculées sur les échantillons
+    double median = 0.0;
+    double p99 = 0.0;
+    double min = 0.0;
+    double mean = 0.0;
+
+    // Compteurs propres au benchmark (nœuds visités, appels de dessin...)
+    std::vector<std::pair<std::string, double>> counters;
+
+    // Calcule médiane, p99, minimum et moyenne
+    void ComputeStats();
+};
+
+class BenchmarkRunner
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    // Corps mesuré : exécute l'opération "iterations" fois
+    typedef std::function<void(long long iterations)> Body;
+
+private:
+    BenchmarkOptions mOptions;
+    std::vector<BenchmarkResult> mResults;
+    int mPinnedCpu;
+
+    // Durée d'un appel du corps (ms)
+    static double TimeBody(const Body& body, long long iterations);
+
+public:
+    // Constructeur
+    explicit BenchmarkRunner(const BenchmarkOptions& options);
+
+    // Fixe le processus sur un cœur et affiche l'en-tête
+    void Start();
+
+    // Vrai si le benchmark passe le filtre
+    bool IsSelected(const std::string& name) const;
+
+    // Micro-benchmark : calibre le nombre d'itérations, chauffe, puis
+    // mesure mOptions.repetitions fois (résultat en ns/op)
+    void Run(const std::string& name, const Body& body);
+
+    // Ajoute un résultat mesuré par l'appelant (statistiques calculées ici)
+    void AddResult(BenchmarkResult result);
+
+    // Réglages de la session
+    const BenchmarkOptions& GetOptions() const;
+
+    // Rend tous les cœurs au thread appelant (Start fixe le processus, et
+    // ses threads, sur un seul cœur) : à appeler depuis chaque thread d'un
+    // benchmark concurrent
+    static void ReleaseThreadAffinity();
+
+    // Écrit tous les résultats au format JSON
+    bool WriteJson(const std::string& path) const;
+};
+
+#endif // BENCHMARK_H
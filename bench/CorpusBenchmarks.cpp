@@ -0,0 +1,184 @@
+// ============================================================================
+// CorpusBenchmarks.cpp
+// Débit du solveur sur des ensembles de grilles de référence
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "Benchmark.h"
+#include "../include/PuzzleCanonicalizer.h"
+#include "../include/PuzzleText.h"
+#include "../include/SudokuSolver.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+// Ensembles mesurés (bench/corpus/<nom>.txt)
+static const char* CORPUS_FILES[] = { "17-clues", "hardest", "random" };
+
+// ============================================================================
+// Charge un fichier : une grille de 81 caractères par ligne, '#' = commentaire
+// ============================================================================
+static bool LoadCorpus(const std::string& path, std::vector<int>& puzzles)
+{
+    PuzzleReader reader;
+    if (!reader.Open(path))
+        return false;
+
+    int cells[CELL_COUNT];
+    while (reader.Next(cells))
+        puzzles.insert(puzzles.end(), cells, cells + CELL_COUNT);
+
+    if (reader.GetInvalidCount() > 0)
+        fprintf(stderr, "[ATTENTION] %s : %llu ligne(s) ignoree(s)\n", path.c_str(),
+                (unsigned long long)reader.GetInvalidCount());
+
+    return true;
+}
+
+// ============================================================================
+// Vérifie qu'une solution respecte les indices et les règles
+// ============================================================================
+static bool IsValidSolution(const int* puzzle, const int* solution)
+{
+    for (int i = 0; i < CELL_COUNT; i++)
+    {
+        if (solution[i] < 1 || solution[i] > 9 ||
+            (puzzle[i] != 0 && puzzle[i] != solution[i]))
+            return false;
+    }
+
+    // Le solveur vérifie les indices au chargement : une grille pleine
+    // acceptée telle quelle n'a aucun conflit
+    SudokuSolver checker;
+    return checker.CountSolutions(solution, 1) == 1;
+}
+
+// ============================================================================
+// Résout tout un corpus à chaque répétition. Faux si une grille n'est pas
+// résolue correctement.
+// ============================================================================
+static bool RunSolverBenchmark(BenchmarkRunner& runner, const std::string& benchName,
+                               const std::vector<int>& puzzles)
+{
+    SudokuSolver solver;
+    size_t count = puzzles.size() / CELL_COUNT;
+    int solution[CELL_COUNT];
+
+    // Chauffe et vérification : chaque grille doit être résolue
+    long long totalNodes = 0;
+    size_t unsolved = 0;
+    for (size_t p = 0; p < count; p++)
+    {
+        const int* puzzle = &puzzles[p * CELL_COUNT];
+        std::copy(puzzle, puzzle + CELL_COUNT, solution);
+        if (!solver.Solve(solution) || !IsValidSolution(puzzle, solution))
+            unsolved++;
+        totalNodes += solver.GetNodeCount();
+    }
+
+    if (unsolved > 0)
+    {
+        fprintf(stderr, "[ERREUR] %s : %zu grille(s) non resolue(s)\n",
+                benchName.c_str(), unsolved);
+        return false;
+    }
+
+    // Chaque répétition résout tout le corpus ; l'échantillon est la
+    // latence moyenne, la queue est calculée sur toutes les grilles
+    BenchmarkResult result;
+    result.name = benchName;
+    result.unit = "us/grille";
+    result.iterations = static_cast<long long>(count);
+
+    std::vector<double> latencies;
+    latencies.reserve(count * runner.GetOptions().repetitions);
+
+    for (int rep = 0; rep < runner.GetOptions().repetitions; rep++)
+    {
+        double total = 0.0;
+        for (size_t p = 0; p < count; p++)
+        {
+            const int* puzzle = &puzzles[p * CELL_COUNT];
+            std::copy(puzzle, puzzle + CELL_COUNT, solution);
+
+            BenchmarkRunner::Clock::time_point start = BenchmarkRunner::Clock::now();
+            solver.Solve(solution);
+            std::chrono::duration<double, std::micro> elapsed =
+                BenchmarkRunner::Clock::now() - start;
+
+            DoNotOptimize(solution);
+            latencies.push_back(elapsed.count());
+            total += elapsed.count();
+        }
+        result.samples.push_back(total / count);
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    size_t p99Rank = static_cast<size_t>(std::ceil(0.99 * latencies.size()));
+    double median = latencies[latencies.size() / 2];
+
+    std::vector<double> sortedSamples(result.samples);
+    std::sort(sortedSamples.begin(), sortedSamples.end());
+    double averageUs = sortedSamples[sortedSamples.size() / 2];
+
+    result.counters.push_back(std::make_pair("grilles", static_cast<double>(count)));
+    result.counters.push_back(std::make_pair("grilles/s", 1e6 / averageUs));
+    result.counters.push_back(std::make_pair("latence mediane (us)", median));
+    result.counters.push_back(std::make_pair("latence p99 (us)",
+                                             latencies[std::max<size_t>(p99Rank, 1) - 1]));
+    result.counters.push_back(std::make_pair("latence max (us)", latencies.back()));
+    result.counters.push_back(std::make_pair("noeuds/grille",
+                                             static_cast<double>(totalNodes) / count));
+
+    runner.AddResult(result);
+    return true;
+}
+
+// ============================================================================
+// Lance les benchmarks du corpus. Faux si un corpus manque ou si une grille
+// n'est pas résolue correctement.
+// ============================================================================
+bool RunCorpusBenchmarks(BenchmarkRunner& runner, const std::string& corpusDir)
+{
+    bool ok = true;
+
+    for (const char* name : CORPUS_FILES)
+    {
+        std::string benchName = std::string("corpus/") + name;
+        std::string canonName = std::string("canon/") + name;
+        bool runSolver = runner.IsSelected(benchName);
+        bool runCanon = runner.IsSelected(canonName);
+        if (!runSolver && !runCanon)
+            continue;
+
+        std::string path = corpusDir + "/" + name + ".txt";
+        std::vector<int> puzzles;
+        if (!LoadCorpus(path, puzzles) || puzzles.empty())
+        {
+            fprintf(stderr, "[ERREUR] Corpus introuvable ou vide: %s\n", path.c_str());
+            ok = false;
+            continue;
+        }
+
+        if (runSolver)
+            ok = RunSolverBenchmark(runner, benchName, puzzles) && ok;
+
+        // Forme canonique et empreinte de chaque grille du corpus
+        if (runCanon)
+        {
+            size_t count = puzzles.size() / CELL_COUNT;
+            PuzzleCanonicalizer canonicalizer;
+            runner.Run(canonName, [&](long long iterations) {
+                for (long long i = 0; i < iterations; i++)
+                {
+                    const int* puzzle = &puzzles[(i % count) * CELL_COUNT];
+                    uint64_t fingerprint = canonicalizer.Fingerprint(puzzle);
+                    DoNotOptimize(fingerprint);
+                }
+            });
+        }
+    }
+
+    return ok;
+}
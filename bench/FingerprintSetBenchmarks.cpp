@@ -0,0 +1,192 @@
+// ============================================================================
+// FingerprintSetBenchmarks.cpp
+// Coût d'une insertion dans l'ensemble d'empreintes (include/FingerprintSet.h),
+// depuis un thread puis depuis plusieurs threads en concurrence
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "Benchmark.h"
+#include "../include/FingerprintSet.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+// Empreintes insérées par répétition (table remplie à moitié à la fin)
+static const uint64_t SET_KEY_COUNT = 1 << 20;
+
+// Threads de la variante concurrente (bornés par le nombre de cœurs)
+static const int SET_MAX_THREADS = 8;
+
+// ============================================================================
+// Empreinte pseudo-aléatoire reproductible (finaliseur de SplitMix64)
+// ============================================================================
+static uint64_t KeyAt(uint64_t index)
+{
+    uint64_t value = index * 0x9E3779B97F4A7C15ull + 1;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+// ============================================================================
+// Insertions concurrentes, comme les threads de build-db. Chaque thread
+// parcourt une fenêtre de "window" clés qui recouvre de moitié celles de ses
+// voisins ; les threads pairs commencent par leur seconde moitié, les
+// impairs par la première : deux voisins insèrent les mêmes clés au même
+// moment. Faux si une clé n'a pas été admise exactement une fois.
+// ============================================================================
+static bool RunConcurrentInsert(BenchmarkRunner& runner, const std::vector<uint64_t>& keys)
+{
+    const char* name = "set/Insert/concurrent";
+    if (!runner.IsSelected(name))
+        return true;
+
+    int threads = static_cast<int>(std::thread::hardware_concurrency());
+    threads = std::max(2, std::min(threads, SET_MAX_THREADS));
+
+    // Fenêtres de "window" clés décalées de window / 2 : elles couvrent
+    // "distinct" clés, chacune proposée par deux threads (une seule aux
+    // extrémités)
+    uint64_t half = keys.size() / (threads + 1);
+    uint64_t window = 2 * half;
+    uint64_t distinct = (threads + 1) * half;
+    uint64_t attempts = threads * window;
+
+    BenchmarkResult result;
+    result.name = name;
+    result.unit = "ns/op";
+    result.iterations = static_cast<long long>(attempts);
+
+    for (int rep = 0; rep < runner.GetOptions().repetitions; rep++)
+    {
+        FingerprintSet set(distinct);
+        std::vector<uint64_t> admitted(threads, 0);
+        std::atomic<int> ready(0);
+        std::atomic<bool> go(false);
+        std::vector<std::thread> workers;
+
+        for (int t = 0; t < threads; t++)
+        {
+            workers.emplace_back([&, t]() {
+                uint64_t first = t * half;
+                uint64_t offset = (t % 2 == 0) ? half : 0;
+                uint64_t added = 0;
+
+                BenchmarkRunner::ReleaseThreadAffinity();
+                ready.fetch_add(1);
+                while (!go.load(std::memory_order_acquire))
+                    std::this_thread::yield();
+
+                for (uint64_t i = 0; i < window; i++)
+                    added += set.Insert(keys[first + (i + offset) % window]);
+                admitted[t] = added;
+            });
+        }
+
+        // Départ simultané, création des threads hors mesure
+        while (ready.load() < threads)
+            std::this_thread::yield();
+        BenchmarkRunner::Clock::time_point start = BenchmarkRunner::Clock::now();
+        go.store(true, std::memory_order_release);
+        for (std::thread& worker : workers)
+            worker.join();
+        std::chrono::duration<double, std::nano> elapsed = BenchmarkRunner::Clock::now() - start;
+        result.samples.push_back(elapsed.count() / attempts);
+
+        // Chaque insertion est comptée une fois (ajout ou doublon), autant
+        // d'admissions que de clés distinctes, et toutes présentes : aucune
+        // clé n'a été admise deux fois ni perdue
+        uint64_t admissions = 0;
+        for (uint64_t added : admitted)
+            admissions += added;
+        bool allPresent = true;
+        for (uint64_t k = 0; k < distinct; k++)
+            allPresent = allPresent && set.Contains(keys[k]);
+
+        if (set.GetSize() + set.GetDuplicateCount() != attempts || set.GetOverflowCount() != 0 ||
+            set.GetSize() != distinct || admissions != distinct || !allPresent)
+        {
+            fprintf(stderr, "[ERREUR] %s : %llu admises, %llu doublons pour %llu cles distinctes "
+                    "et %llu insertions\n", name, (unsigned long long)set.GetSize(),
+                    (unsigned long long)set.GetDuplicateCount(), (unsigned long long)distinct,
+                    (unsigned long long)attempts);
+            return false;
+        }
+    }
+
+    result.counters.push_back(std::make_pair("threads", static_cast<double>(threads)));
+    result.counters.push_back(std::make_pair("cles distinctes", static_cast<double>(distinct)));
+    runner.AddResult(result);
+    return true;
+}
+
+// ============================================================================
+// Lance les benchmarks de l'ensemble d'empreintes. Chaque répétition part
+// d'une table vide : la charge mesurée va de 0 à 50 %, comme pendant la
+// génération d'une base. Faux si la variante concurrente perd ou double
+// une clé.
+// ============================================================================
+bool RunFingerprintSetBenchmarks(BenchmarkRunner& runner)
+{
+    bool runInsert = runner.IsSelected("set/Insert");
+    bool runDuplicate = runner.IsSelected("set/Insert/doublon");
+    bool runConcurrent = runner.IsSelected("set/Insert/concurrent");
+    if (!runInsert && !runDuplicate && !runConcurrent)
+        return true;
+
+    std::vector<uint64_t> keys(SET_KEY_COUNT);
+    for (uint64_t i = 0; i < SET_KEY_COUNT; i++)
+        keys[i] = KeyAt(i);
+
+    if (!runInsert && !runDuplicate)
+        return RunConcurrentInsert(runner, keys);
+
+    BenchmarkResult inserted;
+    inserted.name = "set/Insert";
+    inserted.unit = "ns/op";
+    inserted.iterations = static_cast<long long>(SET_KEY_COUNT);
+
+    BenchmarkResult duplicates = inserted;
+    duplicates.name = "set/Insert/doublon";
+
+    double duplicateRate = 0.0;
+    for (int rep = 0; rep < runner.GetOptions().repetitions; rep++)
+    {
+        FingerprintSet set(SET_KEY_COUNT);
+
+        // Empreintes nouvelles
+        BenchmarkRunner::Clock::time_point start = BenchmarkRunner::Clock::now();
+        uint64_t added = 0;
+        for (uint64_t key : keys)
+            added += set.Insert(key);
+        std::chrono::duration<double, std::nano> elapsed = BenchmarkRunner::Clock::now() - start;
+        DoNotOptimize(added);
+        inserted.samples.push_back(elapsed.count() / SET_KEY_COUNT);
+
+        // Les mêmes : toutes refusées
+        start = BenchmarkRunner::Clock::now();
+        for (uint64_t key : keys)
+            added += set.Insert(key);
+        elapsed = BenchmarkRunner::Clock::now() - start;
+        DoNotOptimize(added);
+        duplicates.samples.push_back(elapsed.count() / SET_KEY_COUNT);
+
+        duplicateRate = set.GetDuplicateRate();
+    }
+
+    if (runInsert)
+    {
+        inserted.counters.push_back(std::make_pair("empreintes", static_cast<double>(SET_KEY_COUNT)));
+        runner.AddResult(inserted);
+    }
+
+    if (runDuplicate)
+    {
+        duplicates.counters.push_back(std::make_pair("taux de doublons", duplicateRate));
+        runner.AddResult(duplicates);
+    }
+
+    return RunConcurrentInsert(runner, keys);
+}
@@ -0,0 +1,53 @@
+// ============================================================================
+// GeneratorBenchmarks.cpp
+// Coût de la génération de grilles à solution unique (PuzzleGenerator) :
+// grilles numérotées, grilles du jour, génération suivie du classement
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "Benchmark.h"
+#include "../include/PuzzleGenerator.h"
+#include <cstdint>
+
+// Premier jour des grilles du jour mesurées (2026-01-01)
+static const uint64_t GEN_FIRST_DAY = 20454;
+
+// ============================================================================
+// Lance les benchmarks du générateur. Chaque appel du corps reprend la même
+// suite de numéros : toutes les répétitions mesurent les mêmes grilles.
+// ============================================================================
+void RunGeneratorBenchmarks(BenchmarkRunner& runner)
+{
+    int cells[CELL_COUNT];
+
+    // Grille n° N, recalculée depuis son numéro (jeu et "sudoku-cli puzzle")
+    runner.Run("gen/GenerateNumbered", [&](long long iterations) {
+        for (long long i = 0; i < iterations; i++)
+        {
+            PuzzleGenerator::GenerateNumbered(static_cast<uint64_t>(i), cells);
+            DoNotOptimize(cells);
+        }
+    });
+
+    // Grille du jour (--daily)
+    runner.Run("gen/GenerateDaily", [&](long long iterations) {
+        for (long long i = 0; i < iterations; i++)
+        {
+            PuzzleGenerator::GenerateDaily(GEN_FIRST_DAY + static_cast<uint64_t>(i), cells);
+            DoNotOptimize(cells);
+        }
+    });
+
+    // Génération puis classement, comme "build-db" et "feed --difficulty"
+    runner.Run("gen/Generate+Grade", [&](long long iterations) {
+        PuzzleGenerator generator(1);
+        int levels = 0;
+        for (long long i = 0; i < iterations; i++)
+        {
+            generator.Generate(cells);
+            levels += PuzzleGenerator::Grade(cells);
+        }
+        DoNotOptimize(levels);
+    });
+}
@@ -0,0 +1,125 @@
+// ============================================================================
+// GridBenchmarks.cpp
+// Micro-benchmarks des opérations de base de SudokuGrid
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "Benchmark.h"
+#include "../include/SudokuGrid.h"
+
+// ============================================================================
+// Remplit une grille complète et valide (motif décalé par ligne et par bloc)
+// ============================================================================
+static void FillSolvedGrid(SudokuGrid& grid)
+{
+    grid.Clear();
+    for (int row = 0; row < GRID_SIZE; row++)
+    {
+        for (int col = 0; col < GRID_SIZE; col++)
+            grid.SetCell(row, col, (row * 3 + row / 3 + col) % GRID_SIZE + 1);
+    }
+}
+
+// ============================================================================
+// Lance les micro-benchmarks de la grille
+// ============================================================================
+void RunGridBenchmarks(BenchmarkRunner& runner)
+{
+    // Grille de jeu typique : 22 cases initiales
+    SudokuGrid grid;
+    grid.Initialize();
+
+    SudokuGrid solved;
+    FillSolvedGrid(solved);
+
+    // Parcourt toutes les cases et tous les chiffres
+    runner.Run("grid/IsValidPlacement", [&](long long iterations) {
+        int cell = 0;
+        int num = 1;
+        int valid = 0;
+        for (long long i = 0; i < iterations; i++)
+        {
+            valid += grid.IsValidPlacement(cell / GRID_SIZE, cell % GRID_SIZE, num);
+            if (++cell == GRID_SIZE * GRID_SIZE)
+            {
+                cell = 0;
+                num = num % GRID_SIZE + 1;
+            }
+        }
+        DoNotOptimize(valid);
+    });
+
+    // Placement puis effacement sur les cases libres (la grille reste intacte)
+    std::vector<int> freeCells;
+    for (int cell = 0; cell < GRID_SIZE * GRID_SIZE; cell++)
+    {
+        if (!grid.IsInitialCell(cell / GRID_SIZE, cell % GRID_SIZE))
+            freeCells.push_back(cell);
+    }
+
+    runner.Run("grid/SetCell+effacement", [&](long long iterations) {
+        size_t index = 0;
+        int num = 1;
+        int placed = 0;
+        for (long long i = 0; i < iterations; i++)
+        {
+            int cell = freeCells[index];
+            placed += grid.SetCell(cell / GRID_SIZE, cell % GRID_SIZE, num);
+            grid.SetCell(cell / GRID_SIZE, cell % GRID_SIZE, 0);
+            if (++index == freeCells.size())
+            {
+                index = 0;
+                num = num % GRID_SIZE + 1;
+            }
+        }
+        DoNotOptimize(placed);
+    });
+
+    // Pire cas : grille pleine, les 81 cases sont lues
+    runner.Run("grid/CheckWin/pleine", [&](long long iterations) {
+        int wins = 0;
+        for (long long i = 0; i < iterations; i++)
+        {
+            wins += solved.CheckWin();
+            DoNotOptimize(solved);
+        }
+        DoNotOptimize(wins);
+    });
+
+    runner.Run("grid/CheckWin/partielle", [&](long long iterations) {
+        int wins = 0;
+        for (long long i = 0; i < iterations; i++)
+        {
+            wins += grid.CheckWin();
+            DoNotOptimize(grid);
+        }
+        DoNotOptimize(wins);
+    });
+
+    SudokuGrid scratch;
+    runner.Run("grid/Clear+GenerateGrid", [&](long long iterations) {
+        for (long long i = 0; i < iterations; i++)
+        {
+            scratch.Clear();
+            scratch.GenerateGrid();
+            DoNotOptimize(scratch);
+        }
+    });
+
+    runner.Run("grid/Clear", [&](long long iterations) {
+        for (long long i = 0; i < iterations; i++)
+        {
+            scratch.Clear();
+            DoNotOptimize(scratch);
+        }
+    });
+
+    runner.Run("grid/Copie", [&](long long iterations) {
+        for (long long i = 0; i < iterations; i++)
+        {
+            SudokuGrid copy(solved);
+            DoNotOptimize(copy);
+        }
+    });
+}
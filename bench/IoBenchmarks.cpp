@@ -0,0 +1,160 @@
+// ============================================================================
+// IoBenchmarks.cpp
+// Débit de la lecture / écriture du format texte (include/PuzzleText.h)
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "Benchmark.h"
+#include "../include/PuzzleText.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+// Lignes du fichier mesuré (environ 8 Mo)
+static const int IO_PUZZLE_COUNT = 100000;
+
+// ============================================================================
+// Fichier mesuré, propre au processus : deux sudoku-bench lancés en même
+// temps ne s'écrasent pas leurs fichiers
+// ============================================================================
+static std::string TemporaryPath()
+{
+#if defined(_WIN32)
+    long long pid = _getpid();
+#else
+    long long pid = getpid();
+#endif
+    std::string name = "sudoku-bench-io-" + std::to_string(pid) + ".txt";
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+// ============================================================================
+// Ajoute les compteurs de débit d'un résultat (échantillons en ns/grille)
+// ============================================================================
+static void AddThroughputCounters(BenchmarkResult& result, uint64_t bytes)
+{
+    std::vector<double> sortedSamples(result.samples);
+    std::sort(sortedSamples.begin(), sortedSamples.end());
+    double nsPerPuzzle = sortedSamples[sortedSamples.size() / 2];
+    double seconds = nsPerPuzzle * IO_PUZZLE_COUNT / 1e9;
+
+    result.counters.push_back(std::make_pair("grilles", static_cast<double>(IO_PUZZLE_COUNT)));
+    result.counters.push_back(std::make_pair("grilles/s", 1e9 / nsPerPuzzle));
+    result.counters.push_back(std::make_pair("Mo/s", bytes / 1e6 / seconds));
+}
+
+// ============================================================================
+// Lance les benchmarks d'import / export. Faux si le fichier temporaire ne
+// peut pas être écrit ou relu.
+// ============================================================================
+bool RunIoBenchmarks(BenchmarkRunner& runner, const std::string& corpusDir)
+{
+    bool runRead = runner.IsSelected("io/lecture");
+    bool runWrite = runner.IsSelected("io/ecriture");
+    if (!runRead && !runWrite)
+        return true;
+
+    // Grilles du corpus aléatoire, répétées jusqu'à IO_PUZZLE_COUNT
+    std::vector<int> source;
+    PuzzleReader corpus;
+    int cells[CELL_COUNT];
+    if (corpus.Open(corpusDir + "/random.txt"))
+    {
+        while (corpus.Next(cells))
+            source.insert(source.end(), cells, cells + CELL_COUNT);
+    }
+
+    if (source.empty())
+    {
+        fprintf(stderr, "[ERREUR] io : corpus introuvable dans %s\n", corpusDir.c_str());
+        return false;
+    }
+
+    size_t sourceCount = source.size() / CELL_COUNT;
+    std::string path = TemporaryPath();
+
+    // Écrit le fichier mesuré ; une répétition de io/ecriture fait de même
+    auto writeFile = [&]() {
+        PuzzleWriter writer;
+        if (!writer.Open(path))
+            return false;
+        for (int p = 0; p < IO_PUZZLE_COUNT; p++)
+            writer.Write(&source[(p % sourceCount) * CELL_COUNT]);
+        return writer.Close();
+    };
+
+    if (!writeFile())
+    {
+        fprintf(stderr, "[ERREUR] io : impossible d'ecrire %s\n", path.c_str());
+        return false;
+    }
+
+    uint64_t fileBytes = static_cast<uint64_t>(IO_PUZZLE_COUNT) * (CELL_COUNT + 1);
+    bool ok = true;
+
+    if (runRead)
+    {
+        BenchmarkResult result;
+        result.name = "io/lecture";
+        result.unit = "ns/grille";
+        result.iterations = IO_PUZZLE_COUNT;
+
+        for (int rep = 0; rep < runner.GetOptions().repetitions && ok; rep++)
+        {
+            PuzzleReader reader;
+            int count = 0;
+
+            BenchmarkRunner::Clock::time_point start = BenchmarkRunner::Clock::now();
+            if (reader.Open(path))
+            {
+                while (reader.Next(cells))
+                    count++;
+            }
+            std::chrono::duration<double, std::nano> elapsed = BenchmarkRunner::Clock::now() - start;
+
+            DoNotOptimize(cells);
+            if (count != IO_PUZZLE_COUNT)
+            {
+                fprintf(stderr, "[ERREUR] io/lecture : %d grille(s) relue(s) sur %d\n",
+                        count, IO_PUZZLE_COUNT);
+                ok = false;
+            }
+            result.samples.push_back(elapsed.count() / IO_PUZZLE_COUNT);
+        }
+
+        if (ok)
+        {
+            AddThroughputCounters(result, fileBytes);
+            runner.AddResult(result);
+        }
+    }
+
+    if (runWrite && ok)
+    {
+        BenchmarkResult result;
+        result.name = "io/ecriture";
+        result.unit = "ns/grille";
+        result.iterations = IO_PUZZLE_COUNT;
+
+        for (int rep = 0; rep < runner.GetOptions().repetitions; rep++)
+        {
+            BenchmarkRunner::Clock::time_point start = BenchmarkRunner::Clock::now();
+            ok = writeFile() && ok;
+            std::chrono::duration<double, std::nano> elapsed = BenchmarkRunner::Clock::now() - start;
+            result.samples.push_back(elapsed.count() / IO_PUZZLE_COUNT);
+        }
+
+        AddThroughputCounters(result, fileBytes);
+        runner.AddResult(result);
+    }
+
+    std::remove(path.c_str());
+    return ok;
+}
@@ -0,0 +1,265 @@
+// ============================================================================
+// RenderBenchmarks.cpp
+// Coût d'une frame et appels de dessin SDL (renderer logiciel hors écran)
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "Benchmark.h"
+#include "../include/Renderer.h"
+#include "../include/SudokuGrid.h"
+#include "../include/UI.h"
+#include "imgui.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+// ============================================================================
+// Compteurs d'appels SDL. build.py lie sudoku-bench avec
+// -Wl,--wrap=<fonction> : les appels du jeu et d'ImGui passent par les
+// fonctions __wrap_ ci-dessous, qui comptent puis appellent la vraie SDL.
+// ============================================================================
+enum RenderCall
+{
+    CALL_CLEAR,
+    CALL_LINE,
+    CALL_FILL_RECT,
+    CALL_GEOMETRY,
+    CALL_DRAW_COLOR,
+    CALL_COUNT
+};
+
+static const char* CALL_NAMES[CALL_COUNT] = {
+    "SDL_RenderClear/frame",
+    "SDL_RenderLine/frame",
+    "SDL_RenderFillRect/frame",
+    "SDL_RenderGeometryRaw/frame",
+    "SDL_SetRenderDrawColor/frame"
+};
+
+static long long sCalls[CALL_COUNT];
+
+extern "C"
+{
+    bool __real_SDL_RenderClear(SDL_Renderer* renderer);
+    bool __real_SDL_RenderLine(SDL_Renderer* renderer, float x1, float y1, float x2, float y2);
+    bool __real_SDL_RenderFillRect(SDL_Renderer* renderer, const SDL_FRect* rect);
+    bool __real_SDL_RenderGeometryRaw(SDL_Renderer* renderer, SDL_Texture* texture,
+                                      const float* xy, int xyStride,
+                                      const SDL_FColor* color, int colorStride,
+                                      const float* uv, int uvStride, int numVertices,
+                                      const void* indices, int numIndices, int sizeIndices);
+    bool __real_SDL_SetRenderDrawColor(SDL_Renderer* renderer, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+
+    bool __wrap_SDL_RenderClear(SDL_Renderer* renderer)
+    {
+        sCalls[CALL_CLEAR]++;
+        return __real_SDL_RenderClear(renderer);
+    }
+
+    bool __wrap_SDL_RenderLine(SDL_Renderer* renderer, float x1, float y1, float x2, float y2)
+    {
+        sCalls[CALL_LINE]++;
+        return __real_SDL_RenderLine(renderer, x1, y1, x2, y2);
+    }
+
+    bool __wrap_SDL_RenderFillRect(SDL_Renderer* renderer, const SDL_FRect* rect)
+    {
+        sCalls[CALL_FILL_RECT]++;
+        return __real_SDL_RenderFillRect(renderer, rect);
+    }
+
+    bool __wrap_SDL_RenderGeometryRaw(SDL_Renderer* renderer, SDL_Texture* texture,
+                                      const float* xy, int xyStride,
+                                      const SDL_FColor* color, int colorStride,
+                                      const float* uv, int uvStride, int numVertices,
+                                      const void* indices, int numIndices, int sizeIndices)
+    {
+        sCalls[CALL_GEOMETRY]++;
+        return __real_SDL_RenderGeometryRaw(renderer, texture, xy, xyStride, color, colorStride,
+                                            uv, uvStride, numVertices, indices, numIndices,
+                                            sizeIndices);
+    }
+
+    bool __wrap_SDL_SetRenderDrawColor(SDL_Renderer* renderer, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+    {
+        sCalls[CALL_DRAW_COLOR]++;
+        return __real_SDL_SetRenderDrawColor(renderer, r, g, b, a);
+    }
+}
+
+// Scénario : contenu de la grille et déplacement de la sélection
+struct RenderScenario
+{
+    const char* name;
+    bool fullGrid;      // Grille remplie au maximum ou grille de jeu
+    bool moveSelection; // Sélection déplacée à chaque frame
+    bool withUI;        // Passe ImGui (menu, barre de statut)
+};
+
+static const RenderScenario SCENARIOS[] = {
+    { "render/grille-de-jeu",          false, false, true  },
+    { "render/grille-pleine",          true,  false, true  },
+    { "render/grille-pleine+selection", true,  true,  true  },
+    { "render/grille-pleine/sans-ui",  true,  true,  false }
+};
+
+// ============================================================================
+// Grille de jeu complétée au mieux : cases initiales en noir, chiffres du
+// joueur en bleu partout où un chiffre valide peut encore être placé
+// ============================================================================
+static void FillBoard(SudokuGrid& grid)
+{
+    grid.Initialize();
+    for (int row = 0; row < GRID_SIZE; row++)
+    {
+        for (int col = 0; col < GRID_SIZE; col++)
+        {
+            for (int num = 1; num <= 9 && grid.GetCell(row, col) == 0; num++)
+                grid.SetCell(row, col, num);
+        }
+    }
+}
+
+// ============================================================================
+// Lance les benchmarks de rendu. Faux si SDL n'a pas pu être initialisée.
+// ============================================================================
+bool RunRenderBenchmarks(BenchmarkRunner& runner, int framesPerRepetition)
+{
+    bool selected = false;
+    for (const RenderScenario& scenario : SCENARIOS)
+        selected = selected || runner.IsSelected(scenario.name);
+    if (!selected)
+        return true;
+
+    // Renderer logiciel hors écran : indépendant du GPU et du compositeur
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen,dummy");
+    if (!SDL_Init(SDL_INIT_VIDEO))
+    {
+        fprintf(stderr, "[ERREUR] SDL_Init: %s\n", SDL_GetError());
+        return false;
+    }
+
+    SDL_Window* window = SDL_CreateWindow("Sudoku - bench", WINDOW_WIDTH, WINDOW_HEIGHT,
+                                          SDL_WINDOW_HIDDEN);
+    SDL_Renderer* sdlRenderer = window ? SDL_CreateRenderer(window, "software") : nullptr;
+    if (!sdlRenderer)
+    {
+        fprintf(stderr, "[ERREUR] Renderer logiciel: %s\n", SDL_GetError());
+        if (window)
+            SDL_DestroyWindow(window);
+        SDL_Quit();
+        return false;
+    }
+
+    Renderer renderer(sdlRenderer);
+    UI ui;
+    ui.Initialize(window, sdlRenderer);
+    ImGui::GetIO().IniFilename = nullptr; // Ne touche pas à imgui.ini
+
+    SudokuGrid gameGrid;
+    gameGrid.Initialize();
+    SudokuGrid fullGrid;
+    FillBoard(fullGrid);
+
+    for (const RenderScenario& scenario : SCENARIOS)
+    {
+        if (!runner.IsSelected(scenario.name))
+            continue;
+
+        SudokuGrid* grid = scenario.fullGrid ? &fullGrid : &gameGrid;
+        int selection = 40; // Case centrale
+
+        // Une frame complète, comme Game::Render
+        auto renderFrame = [&](double* gridUs, double* numbersUs) {
+            int row = selection / GRID_SIZE;
+            int col = selection % GRID_SIZE;
+
+            renderer.Clear();
+            renderer.DrawHighlights(row, col);
+            renderer.DrawSelection(row, col);
+
+            BenchmarkRunner::Clock::time_point start = BenchmarkRunner::Clock::now();
+            renderer.DrawGrid();
+            BenchmarkRunner::Clock::time_point middle = BenchmarkRunner::Clock::now();
+            renderer.DrawNumbers(grid);
+            BenchmarkRunner::Clock::time_point end = BenchmarkRunner::Clock::now();
+
+            *gridUs += std::chrono::duration<double, std::micro>(middle - start).count();
+            *numbersUs += std::chrono::duration<double, std::micro>(end - middle).count();
+
+            if (scenario.withUI)
+            {
+                ui.NewFrame();
+                ui.DrawMainMenu(true);
+                ui.DrawStatusBar(grid);
+                ui.Render();
+            }
+
+            renderer.Present();
+
+            if (scenario.moveSelection)
+                selection = (selection + 1) % CELL_COUNT;
+        };
+
+        // Chauffe : textures d'ImGui, caches du renderer logiciel
+        double ignored = 0.0;
+        for (int i = 0; i < framesPerRepetition / 10 + 1; i++)
+            renderFrame(&ignored, &ignored);
+
+        BenchmarkResult result;
+        result.name = scenario.name;
+        result.unit = "us/frame";
+        result.iterations = framesPerRepetition;
+
+        std::vector<double> frameTimes;
+        frameTimes.reserve(static_cast<size_t>(framesPerRepetition) *
+                           runner.GetOptions().repetitions);
+        double gridUs = 0.0;
+        double numbersUs = 0.0;
+        std::fill(sCalls, sCalls + CALL_COUNT, 0);
+
+        for (int rep = 0; rep < runner.GetOptions().repetitions; rep++)
+        {
+            double total = 0.0;
+            for (int i = 0; i < framesPerRepetition; i++)
+            {
+                BenchmarkRunner::Clock::time_point start = BenchmarkRunner::Clock::now();
+                renderFrame(&gridUs, &numbersUs);
+                std::chrono::duration<double, std::micro> elapsed =
+                    BenchmarkRunner::Clock::now() - start;
+
+                frameTimes.push_back(elapsed.count());
+                total += elapsed.count();
+            }
+            result.samples.push_back(total / framesPerRepetition);
+        }
+
+        double frames = static_cast<double>(frameTimes.size());
+        std::sort(frameTimes.begin(), frameTimes.end());
+        size_t p99Rank = static_cast<size_t>(std::ceil(0.99 * frameTimes.size()));
+
+        long long drawCalls = 0;
+        for (int call = 0; call < CALL_COUNT; call++)
+        {
+            if (call != CALL_DRAW_COLOR)
+                drawCalls += sCalls[call];
+        }
+
+        result.counters.push_back(std::make_pair("frame p99 (us)",
+                                                 frameTimes[std::max<size_t>(p99Rank, 1) - 1]));
+        result.counters.push_back(std::make_pair("DrawGrid (us/frame)", gridUs / frames));
+        result.counters.push_back(std::make_pair("DrawNumbers (us/frame)", numbersUs / frames));
+        result.counters.push_back(std::make_pair("appels de dessin/frame", drawCalls / frames));
+        for (int call = 0; call < CALL_COUNT; call++)
+            result.counters.push_back(std::make_pair(CALL_NAMES[call], sCalls[call] / frames));
+
+        runner.AddResult(result);
+    }
+
+    ui.Shutdown();
+    SDL_DestroyRenderer(sdlRenderer);
+    SDL_DestroyWindow(window);
+    SDL_Quit();
+    return true;
+}
@@ -6,113 +6,895 @@
 # Date: Janvier 2026
 # ============================================================================
 
+import argparse
+import concurrent.futures
+import glob
+import hashlib
+import json
+import math
 import os
+import platform
+import re
+import shutil
 import subprocess
 import sys
+import time
 
-def CollectSources():
-    """Collecte tous les fichiers source .cpp du projet"""
+# Dossier racine de compilation (un sous-dossier par configuration)
+BUILD_DIR = "build"
+
+# Fonctions SDL comptées par les benchmarks de rendu (bench/RenderBenchmarks.cpp)
+BENCH_WRAPPED = ["SDL_RenderClear", "SDL_RenderLine", "SDL_RenderFillRect",
+                 "SDL_RenderGeometryRaw", "SDL_SetRenderDrawColor"]
+
+# Coeur du jeu (grille, solveur, générateur, formats de grilles, session,
+# journalisation) : sans SDL ni ImGui, compilé une fois dans
+# libsudoku_core.a et lié par toutes les autres cibles
+CORE_SOURCES = ["src/FingerprintSet.cpp", "src/Log.cpp", "src/PuzzleCanonicalizer.cpp",
+                "src/PuzzleDatabase.cpp", "src/PuzzleGenerator.cpp", "src/PuzzleRandom.cpp",
+                "src/PuzzleRing.cpp", "src/PuzzleText.cpp", "src/SessionStore.cpp",
+                "src/SudokuGrid.cpp", "src/SudokuSolver.cpp", "src/Trace.cpp"]
+
+# Cibles : dossiers de sources du projet, fichiers supplémentaires, fichiers
+# exclus, sortie et flags d'édition de liens propres à la cible.
+# "libs" : bibliothèques (autres cibles) compilées avant et liées avec la
+# cible ; "library": True produit une bibliothèque statique ;
+# "sdl": False compile sans SDL3 ni ImGui (leurs headers sont introuvables)
+TARGETS = {
+    # Bibliothèque du coeur
+    "core": {
+        "dirs": [],
+        "files": CORE_SOURCES,
+        "exclude": [],
+        "output": "libsudoku_core.a",
+        "ldflags": [],
+        "library": True,
+        "sdl": False
+    },
+    # Le jeu
+    "sudoku": {
+        "dirs": ["src"],
+        "exclude": CORE_SOURCES,
+        "output": "sudoku",
+        "ldflags": [],
+        "libs": ["core"]
+    },
+    # Benchmarks : le code du jeu sans son main(), plus bench/
+    "bench": {
+        "dirs": ["src", "bench"],
+        "exclude": CORE_SOURCES + ["src/main.cpp"],
+        "output": "sudoku-bench",
+        "ldflags": ["-Wl,--wrap=" + f for f in BENCH_WRAPPED],
+        "libs": ["core"]
+    },
+    # Outil en ligne de commande : cli/ et le coeur
+    "cli": {
+        "dirs": ["cli"],
+        "exclude": [],
+        "output": "sudoku-cli",
+        "ldflags": [],
+        "libs": ["core"],
+        "sdl": False
+    }
+}
+
+# Configurations de compilation : flags de compilation et d'édition de liens
+CONFIGS = {
+    # Développement : aucune optimisation, symboles complets
+    "debug": {
+        "cflags": ["-O0", "-g"],
+        "ldflags": []
+    },
+    # Mesures et distribution : optimisation maximale + ThinLTO
+    "release": {
+        "cflags": ["-O3", "-DNDEBUG", "-flto=thin"],
+        "ldflags": ["-O3", "-flto=thin", "-fuse-ld=lld"]
+    },
+    # Optimisé mais débogable
+    "relwithdebinfo": {
+        "cflags": ["-O2", "-g", "-DNDEBUG"],
+        "ldflags": []
+    },
+    # Pour perf : pointeurs de frame conservés pour des piles d'appel fiables
+    "profile": {
+        "cflags": ["-O2", "-g", "-DNDEBUG",
+                   "-fno-omit-frame-pointer", "-mno-omit-leaf-frame-pointer"],
+        "ldflags": []
+    }
+}
+
+# Distribution : release sans la démo ImGui (jamais appelée) ni les outils
+# de débogage ImGui, et suppression des fonctions/données non référencées
+CONFIGS["production"] = {
+    "cflags": CONFIGS["release"]["cflags"] + [
+        "-ffunction-sections", "-fdata-sections",
+        "-DIMGUI_DISABLE_DEMO_WINDOWS", "-DIMGUI_DISABLE_DEBUG_TOOLS"],
+    "ldflags": CONFIGS["release"]["ldflags"] + ["-Wl,--gc-sections"],
+    "imgui_demo": False
+}
+
+# Profil PGO fusionné (entrée de la configuration "pgo")
+PGO_PROFILE = os.path.join(BUILD_DIR, "pgo-instrument", "sudoku.profdata")
+
+# Optimisation guidée par profil (--pgo) : binaire instrumenté, puis
+# recompilation avec le profil mesuré. Dérivées de "release".
+CONFIGS["pgo-instrument"] = {
+    "cflags": CONFIGS["release"]["cflags"] + ["-fprofile-instr-generate"],
+    "ldflags": CONFIGS["release"]["ldflags"] + ["-fprofile-instr-generate"]
+}
+CONFIGS["pgo"] = {
+    "cflags": CONFIGS["release"]["cflags"] + ["-fprofile-instr-use=" + PGO_PROFILE],
+    # --emit-relocs : permet à BOLT de réordonner le binaire final
+    "ldflags": CONFIGS["release"]["ldflags"] + ["-Wl,--emit-relocs"]
+}
+
+# Cibles compilées avec le profil : le coeur (solveur, générateur) est
+# partagé par le jeu, l'outil et les benchmarks
+PGO_TARGETS = ["sudoku", "cli", "bench"]
+
+# Grilles produites par la charge de travail (puis notées)
+PGO_PUZZLES = os.path.join(BUILD_DIR, "pgo-instrument", "puzzles.txt")
+
+# Charge de travail représentative exécutée par les binaires instrumentés :
+# (cible, arguments). Génération, notation et résolution des corpus passent
+# par sudoku-cli ; la boucle de jeu headless couvre le rendu et l'interface.
+PGO_WORKLOAD = [
+    ("cli", ["generate", "--count=2000", "--seed=1", "--threads=1",
+             "--output=" + PGO_PUZZLES]),
+    ("cli", ["grade", "--input=" + PGO_PUZZLES, "--output=" + os.devnull]),
+    ("cli", ["solve", "--input=bench/corpus/random.txt", "--output=" + os.devnull]),
+    ("cli", ["solve", "--input=bench/corpus/hardest.txt", "--output=" + os.devnull]),
+    ("cli", ["solve", "--input=bench/corpus/17-clues.txt", "--output=" + os.devnull]),
+    ("sudoku", ["--headless", "--frames=3000"])
+]
+
+# Mesure de l'accélération : médianes de sudoku-bench sur ces familles
+PGO_BENCHMARK_TRACKS = ["corpus/", "gen/", "canon/", "grid/"]
+
+# Fichiers chauds sans exceptions ni RTTI (--no-exceptions-hot) :
+# aucun ne lance ni n'attrape d'exception, aucun n'utilise dynamic_cast/typeid
+HOT_SOURCES = ["src/SudokuGrid.cpp", "src/Renderer.cpp"]
+
+# En-tête précompilé (--pch) : SDL3 et ImGui, inclus par presque tous les
+# fichiers du projet
+PCH_HEADER = "include/Precompiled.h"
+
+# Références des benchmarks (bench --save-baseline / --compare), une par
+# machine et par configuration
+BENCH_BASELINE_DIR = os.path.join("bench", "baselines")
+
+# Benchmarks suivis par --compare (préfixes des noms) : une régression sur
+# l'un d'eux fait échouer la commande, les autres sont seulement affichés.
+# gen/ couvre le générateur qui produit les grilles du jeu, de la base et de
+# l'anneau ; grid/Clear+GenerateGrid, l'ancien remplissage aléatoire.
+BENCH_TRACKED = ["grid/Clear+GenerateGrid", "gen/", "corpus/", "canon/", "render/", "io/"]
+
+# Seuil de signification du test de Mann-Whitney
+BENCH_ALPHA = 0.01
+
+# Fichier touché par --measure-build pour la mesure incrémentale
+MEASURE_TOUCH = "src/SudokuGrid.cpp"
+
+def CollectSources(config, target):
+    """Collecte tous les fichiers source .cpp d'une cible"""
     sources = []
-    
-    # Collecte les fichiers dans src/
-    if os.path.exists("src"):
-        for root, dirs, files in os.walk("src"):
+
+    # Collecte les fichiers des dossiers de la cible (src/, bench/...)
+    for directory in TARGETS[target]["dirs"]:
+        for root, dirs, files in os.walk(directory):
             for file in files:
-                if file.endswith(".cpp"):
-                    sources.append(os.path.join(root, file))
-    
+                path = os.path.join(root, file)
+                if file.endswith(".cpp") and path not in TARGETS[target]["exclude"]:
+                    sources.append(path)
+
+    # Fichiers isolés (hors des dossiers de la cible)
+    sources.extend(TARGETS[target].get("files", []))
+
     # Collecte les fichiers ImGui
     imgui_path = "thirdparty/imgui"
-    if os.path.exists(imgui_path):
+    if TARGETS[target].get("sdl", True) and os.path.exists(imgui_path):
         # Fichiers principaux d'ImGui
-        for f in ["imgui.cpp", "imgui_draw.cpp", "imgui_tables.cpp", 
-                  "imgui_widgets.cpp", "imgui_demo.cpp"]:
+        for f in ["imgui.cpp", "imgui_draw.cpp", "imgui_tables.cpp",
+                  "imgui_widgets.cpp"]:
             sources.append(os.path.join(imgui_path, f))
-        
+
+        # Démo ImGui (~11 000 lignes) : utile en développement seulement
+        if CONFIGS[config].get("imgui_demo", True):
+            sources.append(os.path.join(imgui_path, "imgui_demo.cpp"))
+
         # Backends SDL3 pour ImGui
         for f in ["imgui_impl_sdl3.cpp", "imgui_impl_sdlrenderer3.cpp"]:
             sources.append(os.path.join(imgui_path, "backends", f))
-    
-    return sources
 
-def Build():
-    """Compile le projet"""
-    print("=" * 50)
-    print("COMPILATION SUDOKU - Just Max It, Everyday")
-    print("=" * 50)
-    
-    # Collecte les fichiers source
-    sources = CollectSources()
-    if not sources:
-        print("ERREUR: Aucun fichier source trouve")
-        return False
-    
-    print(f"\nFichiers a compiler: {len(sources)}")
-    
-    # Récupère les flags de compilation SDL3
+    return sorted(sources)
+
+def GetSDLFlags():
+    """Récupère les flags de compilation et d'édition de liens de SDL3"""
     try:
-        sdl_cflags = subprocess.check_output(
+        cflags = subprocess.check_output(
             ["pkg-config", "sdl3", "--cflags"],
             text=True
         ).strip().split()
-        
-        sdl_libs = subprocess.check_output(
+
+        libs = subprocess.check_output(
             ["pkg-config", "sdl3", "--libs"],
             text=True
         ).strip().split()
     except subprocess.CalledProcessError:
         print("ERREUR: SDL3 non trouve via pkg-config")
-        return False
+        return None, None
     except FileNotFoundError:
         print("ERREUR: pkg-config non trouve")
+        return None, None
+
+    return cflags, libs
+
+def ConfigDir(config):
+    """Dossier de sortie d'une configuration"""
+    return os.path.join(BUILD_DIR, config)
+
+def ExecutablePath(config, target="sudoku"):
+    """Chemin de l'exécutable (ou de la bibliothèque) d'une cible"""
+    return os.path.join(ConfigDir(config), TARGETS[target]["output"])
+
+def ObjectPath(config, source):
+    """Chemin du fichier objet d'un source (arborescence miroir)"""
+    # Sources générés (build unitaire) : objet à côté du source
+    if source.startswith(ConfigDir(config) + os.sep):
+        return source + ".o"
+    return os.path.join(ConfigDir(config), "obj", source + ".o")
+
+def PchPath(config):
+    """Chemin de l'en-tête précompilé d'une configuration"""
+    return os.path.join(ConfigDir(config), "pch", os.path.basename(PCH_HEADER) + ".pch")
+
+def WriteIfChanged(path, content):
+    """Écrit un fichier seulement si son contenu change (préserve la date)"""
+    try:
+        with open(path) as f:
+            if f.read() == content:
+                return
+    except OSError:
+        pass
+
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w") as f:
+        f.write(content)
+
+def GenerateUnitySource(config, target, sources):
+    """Regroupe les sources du projet dans un seul fichier (build unitaire)"""
+    path = os.path.join(ConfigDir(config), "unity", "unity_" + target + ".cpp")
+    lines = ["// Genere par build.py (--unity) : ne pas modifier\n"]
+    for source in sources:
+        relative = os.path.relpath(source, os.path.dirname(path))
+        lines.append('#include "' + relative.replace(os.sep, "/") + '"\n')
+    WriteIfChanged(path, "".join(lines))
+    return path
+
+def ParseDepFile(path):
+    """Lit un fichier de dépendances -MMD et retourne la liste des fichiers"""
+    try:
+        with open(path) as f:
+            content = f.read()
+    except OSError:
+        return None
+
+    # Format Makefile : "cible.o: dep1 dep2 \
+    #   dep3 ..."
+    content = content.replace("\\\n", " ")
+    _, _, deps = content.partition(":")
+    return [d for d in deps.split() if d != "\\"]
+
+def NeedsCompile(obj, flags_hash):
+    """Vrai si le source d'un objet, un de ses headers ou les flags ont changé"""
+    if not os.path.exists(obj):
+        return True
+
+    # Flags différents depuis la dernière compilation
+    stamp = obj + ".flags"
+    try:
+        with open(stamp) as f:
+            if f.read() != flags_hash:
+                return True
+    except OSError:
+        return True
+
+    # Pas de fichier de dépendances : on ne peut rien garantir
+    deps = ParseDepFile(os.path.splitext(obj)[0] + ".d")
+    if deps is None:
+        return True
+
+    obj_time = os.path.getmtime(obj)
+    for dep in deps:
+        if not os.path.exists(dep) or os.path.getmtime(dep) > obj_time:
+            return True
+
+    return False
+
+def CompileObject(source, obj, compile_cmd, flags_hash):
+    """Compile un source en objet (exécuté en parallèle)"""
+    os.makedirs(os.path.dirname(obj), exist_ok=True)
+
+    # L'en-tête précompilé se compile comme un objet, sans -c
+    mode = ["-x", "c++-header"] if obj.endswith(".pch") else ["-c"]
+    cmd = compile_cmd + ["-MMD", "-MF", os.path.splitext(obj)[0] + ".d"] + mode + [
+        source, "-o", obj]
+    result = subprocess.run(cmd, capture_output=True, text=True)
+
+    if result.returncode == 0:
+        with open(obj + ".flags", "w") as f:
+            f.write(flags_hash)
+
+    return source, result.returncode, result.stdout + result.stderr
+
+def CompileFlags(config, options, source):
+    """Flags de compilation d'un fichier pour une configuration"""
+    flags = list(CONFIGS[config]["cflags"])
+
+    if options.march:
+        flags.append("-march=" + options.march)
+
+    if options.no_exceptions_hot and source in HOT_SOURCES:
+        flags.extend(["-fno-exceptions", "-fno-rtti"])
+
+    return flags
+
+def UsesPch(options, source):
+    """Vrai si un source est compilé avec l'en-tête précompilé"""
+    # Le PCH doit avoir exactement les mêmes flags que le source : les
+    # fichiers chauds (flags propres) et ImGui (non concerné) en sont exclus
+    if not options.pch or source.startswith("thirdparty"):
+        return False
+    return not (options.no_exceptions_hot and source in HOT_SOURCES)
+
+def ReportBinarySize(binary):
+    """Affiche la taille de l'exécutable (et de ses sections si possible)"""
+    print(f"Taille de {binary}: {os.path.getsize(binary) / 1024:.1f} Kio")
+
+    # Détail text/data/bss (binutils), hors informations de débogage
+    try:
+        output = subprocess.check_output(["size", binary], text=True)
+        print("  " + output.strip().replace("\n", "\n  "))
+    except (OSError, subprocess.CalledProcessError):
+        pass
+
+def Build(config, options, target="sudoku"):
+    """Compile une cible du projet"""
+    print("=" * 50)
+    print("COMPILATION SUDOKU - Just Max It, Everyday")
+    print("=" * 50)
+
+    start_time = time.time()
+
+    # Collecte les fichiers source
+    sources = CollectSources(config, target)
+    if not sources:
+        print("ERREUR: Aucun fichier source trouve")
         return False
-    
-    # Construit la commande de compilation
-    cmd = [
+
+    # Build unitaire : les sources du projet forment une seule unité de
+    # compilation, ImGui reste compilé fichier par fichier
+    if options.unity:
+        if options.no_exceptions_hot:
+            print("ATTENTION: --no-exceptions-hot ignore avec --unity")
+        project = [s for s in sources if not s.startswith("thirdparty")]
+        others = [s for s in sources if s.startswith("thirdparty")]
+        sources = [GenerateUnitySource(config, target, project)] + others
+
+    # Bibliothèques de la cible, compilées d'abord
+    libraries = []
+    for lib in TARGETS[target].get("libs", []):
+        if not Build(config, options, lib):
+            return False
+        libraries.append(ExecutablePath(config, lib))
+
+    # Récupère les flags de compilation SDL3 (cibles graphiques seulement)
+    uses_sdl = TARGETS[target].get("sdl", True)
+    sdl_cflags, sdl_libs = GetSDLFlags() if uses_sdl else ([], [])
+    if sdl_cflags is None:
+        return False
+
+    # Commande de compilation commune à tous les fichiers
+    base_cmd = [
         "clang++",                          # Compilateur
         "-std=c++17",                       # Standard C++17
         "-Wall",                            # Tous les warnings
         "-Wextra",                          # Warnings supplémentaires
         "-Wno-unused-parameter",            # Ignore les paramètres non utilisés
-        "-g",                               # Symboles de débogage
-        "-Iinclude",                        # Dossier des headers du projet
-        "-Ithirdparty/imgui",               # Dossier ImGui
-        "-Ithirdparty/imgui/backends"       # Dossier backends ImGui
+        "-pthread",                         # Thread de journalisation
+        "-Iinclude"                         # Dossier des headers du projet
     ]
-    
-    # Ajoute les flags SDL3
-    cmd.extend(sdl_cflags)
-    
-    # Ajoute tous les fichiers source
-    cmd.extend(sources)
-    
-    # Ajoute les bibliothèques SDL3
-    cmd.extend(sdl_libs)
-    
-    # Nom de l'exécutable final
-    cmd.extend(["-o", "sudoku"])
-    
-    # Affiche la commande (pour débogage)
-    print("\nCommande de compilation:")
-    print(" ".join(cmd))
-    print()
-    
-    # Lance la compilation
-    result = subprocess.run(cmd)
-    
-    if result.returncode == 0:
-        print("\n" + "=" * 50)
-        print("COMPILATION REUSSIE !")
-        print("=" * 50)
-        print("\nPour lancer le jeu, tape:")
-        print("  ./sudoku")
-        return True
-    else:
+    if uses_sdl:
+        base_cmd.extend(["-Ithirdparty/imgui",              # Dossier ImGui
+                         "-Ithirdparty/imgui/backends"])    # Backends ImGui
+    base_cmd.extend(sdl_cflags)
+
+    # L'en-tête précompilé contient SDL3 et ImGui
+    use_pch = options.pch and uses_sdl
+
+    # Commande complète de chaque fichier ; un changement de flags
+    # invalide l'objet correspondant
+    commands = {}
+    for source in sources:
+        cmd = base_cmd + CompileFlags(config, options, source)
+        if use_pch and UsesPch(options, source):
+            cmd = cmd + ["-include-pch", PchPath(config)]
+        commands[source] = (cmd, hashlib.sha1(" ".join(cmd).encode()).hexdigest())
+
+    print(f"\nConfiguration: {config}" +
+          (f" (-march={options.march})" if options.march else "") +
+          (" [unitaire]" if options.unity else "") +
+          (" [pch]" if use_pch else ""))
+
+    # En-tête précompilé : construit avant tout le reste (mêmes flags que
+    # les sources qui l'utilisent)
+    if use_pch:
+        pch_cmd = base_cmd + CompileFlags(config, options, PCH_HEADER)
+        pch_hash = hashlib.sha1(" ".join(pch_cmd).encode()).hexdigest()
+        if NeedsCompile(PchPath(config), pch_hash):
+            _, code, output = CompileObject(PCH_HEADER, PchPath(config), pch_cmd, pch_hash)
+            print(("  [OK]     " if code == 0 else "  [ERREUR] ") + PCH_HEADER)
+            if output:
+                print(output, end="")
+            if code != 0:
+                return False
+
+    # Ne recompile que les fichiers modifiés (ou dont un header a changé)
+    # (un PCH reconstruit invalide tous les fichiers qui l'utilisent)
+    def Outdated(source):
+        obj = ObjectPath(config, source)
+        if NeedsCompile(obj, commands[source][1]):
+            return True
+        return (use_pch and UsesPch(options, source) and
+                os.path.getmtime(PchPath(config)) > os.path.getmtime(obj))
+
+    to_compile = [s for s in sources if Outdated(s)]
+
+    print(f"Fichiers a compiler: {len(to_compile)}/{len(sources)} "
+          f"({options.jobs} en parallele)")
+
+    failed = False
+    with concurrent.futures.ThreadPoolExecutor(max_workers=options.jobs) as pool:
+        futures = [pool.submit(CompileObject, s, ObjectPath(config, s),
+                               commands[s][0], commands[s][1])
+                   for s in to_compile]
+        for future in concurrent.futures.as_completed(futures):
+            source, code, output = future.result()
+            print(("  [OK]     " if code == 0 else "  [ERREUR] ") + source)
+            if output:
+                print(output, end="")
+            if code != 0:
+                failed = True
+
+    if failed:
         print("\n" + "=" * 50)
         print("ERREUR DE COMPILATION")
         print("=" * 50)
         return False
 
+    # Édition de liens seulement si un objet (ou une bibliothèque) est plus
+    # récent que la sortie
+    output = ExecutablePath(config, target)
+    objects = [ObjectPath(config, s) for s in sources]
+    relink = (not os.path.exists(output) or
+              any(os.path.getmtime(o) > os.path.getmtime(output)
+                  for o in objects + libraries))
+
+    if relink:
+        if TARGETS[target].get("library", False):
+            # Archive recréée : un source retiré n'y laisse pas son objet.
+            # llvm-ar indexe aussi les objets LTO (bitcode)
+            if os.path.exists(output):
+                os.remove(output)
+            link_cmd = ["llvm-ar", "rcs", output] + objects
+        else:
+            link_cmd = (["clang++", "-pthread"] + CONFIGS[config]["ldflags"] +
+                        TARGETS[target]["ldflags"] + objects + libraries + sdl_libs +
+                        ["-o", output])
+        print("\nEdition de liens: " + output)
+        result = subprocess.run(link_cmd)
+        if result.returncode != 0:
+            print("\n" + "=" * 50)
+            print("ERREUR D'EDITION DE LIENS")
+            print("=" * 50)
+            return False
+    else:
+        print("\nSortie a jour: " + output)
+
+    elapsed = time.time() - start_time
+    print("\n" + "=" * 50)
+    print(f"COMPILATION REUSSIE ! ({elapsed:.1f} s)")
+    print("=" * 50)
+    if not TARGETS[target].get("library", False):
+        ReportBinarySize(output)
+    if target == "sudoku":
+        print("\nPour lancer le jeu, tape:")
+        print("  ./" + output)
+    elif target == "cli":
+        print("\nPour l'aide de l'outil, tape:")
+        print("  ./" + output + " --help")
+    return True
+
+def Clean(config):
+    """Supprime les objets et l'exécutable d'une configuration"""
+    if os.path.exists(ConfigDir(config)):
+        shutil.rmtree(ConfigDir(config))
+    print("Nettoyage termine: " + ConfigDir(config))
+
+def MeasureBuild(config, options):
+    """Mesure une compilation complète puis une compilation incrémentale"""
+    Clean(config)
+    start = time.time()
+    if not Build(config, options):
+        return False
+    clean_time = time.time() - start
+
+    # Modification simulée d'un seul fichier du projet
+    os.utime(MEASURE_TOUCH)
+    start = time.time()
+    if not Build(config, options):
+        return False
+    incremental_time = time.time() - start
+
+    print("\n" + "=" * 50)
+    print("TEMPS DE COMPILATION (" + config +
+          (", unitaire" if options.unity else "") +
+          (", pch" if options.pch else "") + ")")
+    print("=" * 50)
+    print(f"  {'complete':14} {clean_time:8.1f} s")
+    print(f"  {'incrementale':14} {incremental_time:8.1f} s  (" + MEASURE_TOUCH + " modifie)")
+    return True
+
+def Run(cmd, env=None):
+    """Lance une commande en affichant la ligne, retourne le code de sortie"""
+    print("  $ " + " ".join(cmd))
+    return subprocess.run(cmd, env=env).returncode
+
+def BenchMedians(config, track):
+    """Médianes de sudoku-bench (nom -> médiane) pour une famille"""
+    path = os.path.join(ConfigDir(config), "pgo-" + track.strip("/") + ".json")
+    if Run([ExecutablePath(config, "bench"), "--json=" + path, "--filter=" + track]) != 0:
+        return None
+    with open(path) as f:
+        return {b["name"]: b["median"] for b in json.load(f)["benchmarks"]}
+
+def WorkloadTime(binary, runs=3):
+    """Durée médiane (s) de la partie sudoku-cli de la charge de travail"""
+    samples = []
+    for _ in range(runs):
+        start = time.time()
+        for target, args in PGO_WORKLOAD:
+            if target == "cli" and subprocess.run([binary] + args,
+                                                  capture_output=True).returncode != 0:
+                return None
+        samples.append(time.time() - start)
+    return sorted(samples)[len(samples) // 2]
+
+def BuildPGO(options):
+    """Compilation en deux étapes guidée par profil, puis BOLT optionnel"""
+    # Étape 1 : binaires instrumentés
+    Clean("pgo-instrument")
+    for target in PGO_TARGETS:
+        if not Build("pgo-instrument", options, target):
+            return False
+
+    # Exécution de la charge de travail représentative
+    print("\nPGO: execution de la charge de travail")
+    profile_dir = os.path.join(ConfigDir("pgo-instrument"), "profiles")
+    os.makedirs(profile_dir, exist_ok=True)
+    env = dict(os.environ, LLVM_PROFILE_FILE=os.path.join(profile_dir, "%p.profraw"))
+    for target, args in PGO_WORKLOAD:
+        if Run([ExecutablePath("pgo-instrument", target)] + args, env) != 0:
+            print("ERREUR: la charge de travail PGO a echoue")
+            return False
+
+    raw_profiles = glob.glob(os.path.join(profile_dir, "*.profraw"))
+    if Run(["llvm-profdata", "merge", "-o", PGO_PROFILE] + raw_profiles) != 0:
+        print("ERREUR: llvm-profdata merge a echoue")
+        return False
+
+    # Étape 2 : recompilation complète avec le profil (le profil n'entre
+    # pas dans le suivi des dépendances)
+    Clean("pgo")
+    for target in PGO_TARGETS:
+        if not Build("pgo", options, target):
+            return False
+
+    cli_candidates = [("pgo", ExecutablePath("pgo", "cli"))]
+
+    # Étape optionnelle : BOLT sur sudoku-cli (solveur et générateur), avec
+    # la même charge de travail. Chaque exécution écrit son propre profil
+    # (suffixe pid), fusionnés par merge-fdata : sinon seule la dernière
+    # commande de la charge compterait.
+    if options.bolt:
+        binary = ExecutablePath("pgo", "cli")
+        instrumented = binary + ".bolt-instrument"
+        fdata_dir = os.path.join(ConfigDir("pgo"), "bolt-profiles")
+        fdata = os.path.join(ConfigDir("pgo"), "bolt.fdata")
+        bolted = binary + ".bolt"
+        shutil.rmtree(fdata_dir, ignore_errors=True)
+        os.makedirs(fdata_dir)
+
+        print("\nBOLT: instrumentation et optimisation de la disposition")
+        ok = Run(["llvm-bolt", binary, "-instrument",
+                  "--instrumentation-file=" + os.path.join(fdata_dir, "bolt.fdata"),
+                  "--instrumentation-file-append-pid", "-o", instrumented]) == 0
+        for target, args in PGO_WORKLOAD:
+            if target == "cli":
+                ok = ok and Run([instrumented] + args) == 0
+
+        run_profiles = glob.glob(os.path.join(fdata_dir, "bolt.fdata.*"))
+        if ok:
+            print("  $ merge-fdata " + " ".join(run_profiles) + " > " + fdata)
+            with open(fdata, "w") as f:
+                ok = bool(run_profiles) and subprocess.run(["merge-fdata"] + run_profiles,
+                                                           stdout=f).returncode == 0
+        ok = ok and Run(["llvm-bolt", binary, "-o", bolted, "-data=" + fdata,
+                         "-reorder-blocks=ext-tsp", "-reorder-functions=hfsort",
+                         "-split-functions", "-split-all-cold", "-dyno-stats"]) == 0
+        if not ok:
+            print("ERREUR: BOLT a echoue")
+            return False
+        cli_candidates.append(("pgo+bolt", bolted))
+
+    # Référence : configuration release avec les mêmes options
+    for target in ["cli", "bench"]:
+        if not Build("release", options, target):
+            return False
+
+    # Accélération sur les benchmarks du solveur et de la grille (rapport
+    # des médianes : > 1 = plus rapide)
+    print("\nPGO: mesure des benchmarks")
+    ratios = []
+    rows = []
+    for track in PGO_BENCHMARK_TRACKS:
+        baseline = BenchMedians("release", track)
+        optimized = BenchMedians("pgo", track)
+        if baseline is None or optimized is None:
+            print("ERREUR: sudoku-bench a echoue")
+            return False
+        for name in sorted(baseline):
+            if name in optimized and optimized[name] > 0:
+                ratio = baseline[name] / optimized[name]
+                ratios.append(ratio)
+                rows.append((name, baseline[name], optimized[name], ratio))
+
+    print("\n" + "=" * 50)
+    print("ACCELERATION (sudoku-bench, medianes, " + " ".join(PGO_BENCHMARK_TRACKS) + ")")
+    print("=" * 50)
+    print(f"  {'Benchmark':32} {'release':>12} {'pgo':>12}")
+    for name, reference, value, ratio in rows:
+        print(f"  {name:32} {reference:12.2f} {value:12.2f}  (x{ratio:.3f})")
+    if ratios:
+        mean = math.exp(sum(math.log(r) for r in ratios) / len(ratios))
+        print(f"  {'moyenne geometrique':32} {'':12} {'':12}  (x{mean:.3f})")
+
+    # Durée de bout en bout de la charge sudoku-cli (BOLT compris)
+    print("\nCharge de travail sudoku-cli (mediane de 3):")
+    baseline = WorkloadTime(ExecutablePath("release", "cli"))
+    if baseline is None:
+        print("ERREUR: la charge de travail a echoue en release")
+        return False
+    print(f"  {'release':10} {baseline:8.2f} s")
+    for name, binary in cli_candidates:
+        elapsed = WorkloadTime(binary)
+        if elapsed is None:
+            print(f"  {name:10} mesure impossible")
+            continue
+        print(f"  {name:10} {elapsed:8.2f} s  (x{baseline / elapsed:.3f})")
+
+    return True
+
+def CheckGolden(config):
+    """Vérifie les empreintes de référence de sudoku-cli (grilles numérotées
+    et grilles du jour identiques sur toutes les compilations)"""
+    print("\nVerification du determinisme (sudoku-cli golden):")
+    if Run([ExecutablePath(config, "cli"), "golden"]) != 0:
+        print("ERREUR: grilles differentes des valeurs de reference "
+              "(voir PUZZLE_ALGORITHM_VERSION dans include/PuzzleGenerator.h)")
+        return False
+    return True
+
+def BenchResultsPath(config):
+    """Fichier JSON des derniers résultats de benchmark d'une configuration"""
+    return os.path.join(ConfigDir(config), "bench.json")
+
+def RunBenchmarks(config, options):
+    """Compile et lance les benchmarks, résultats en JSON"""
+    if not Build(config, options, "bench"):
+        return False
+
+    print("\n" + "=" * 50)
+    print("BENCHMARKS (" + config + ")")
+    print("=" * 50)
+    cmd = [ExecutablePath(config, "bench"), "--json=" + BenchResultsPath(config)]
+    if options.bench_filter:
+        cmd.append("--filter=" + options.bench_filter)
+    if options.bench_repetitions:
+        cmd.append("--repetitions=" + str(options.bench_repetitions))
+    if options.bench_frames:
+        cmd.append("--frames=" + str(options.bench_frames))
+    if Run(cmd) != 0:
+        return False
+
+    if options.save_baseline:
+        os.makedirs(BENCH_BASELINE_DIR, exist_ok=True)
+        shutil.copyfile(BenchResultsPath(config), BaselinePath(config))
+        print("\nReference enregistree: " + BaselinePath(config))
+
+    if options.compare:
+        return CompareBenchmarks(BaselinePath(config), BenchResultsPath(config),
+                                 options.threshold / 100.0)
+    return True
+
+def MachineName():
+    """Nom de la machine utilisé comme clé des références"""
+    name = platform.node() or "machine"
+    return re.sub(r"[^A-Za-z0-9_.-]", "_", name) + "-" + (platform.machine() or "cpu")
+
+def BaselinePath(config):
+    """Référence des benchmarks de cette machine pour une configuration"""
+    return os.path.join(BENCH_BASELINE_DIR, MachineName() + "-" + config + ".json")
+
+def MannWhitneyGreater(current, baseline):
+    """p-valeur unilatérale : les mesures actuelles sont-elles plus grandes ?
+
+    Test de Mann-Whitney (rangs, sans hypothèse de loi normale) avec
+    approximation normale, correction des ex-aequo et de continuité.
+    """
+    n1, n2 = len(current), len(baseline)
+    if n1 == 0 or n2 == 0:
+        return 1.0
+
+    values = sorted([(v, 0) for v in current] + [(v, 1) for v in baseline])
+    total = n1 + n2
+
+    # Rangs moyens des ex-aequo
+    rank_sum = 0.0
+    tie_term = 0.0
+    i = 0
+    while i < total:
+        j = i
+        while j + 1 < total and values[j + 1][0] == values[i][0]:
+            j += 1
+        rank = (i + j) / 2.0 + 1.0
+        rank_sum += rank * sum(1 for k in range(i, j + 1) if values[k][1] == 0)
+        ties = j - i + 1
+        tie_term += ties ** 3 - ties
+        i = j + 1
+
+    u = rank_sum - n1 * (n1 + 1) / 2.0
+    mean = n1 * n2 / 2.0
+    variance = n1 * n2 / 12.0 * ((total + 1) - tie_term / (total * (total - 1)))
+    if variance <= 0:
+        return 1.0
+
+    z = (u - mean - 0.5) / math.sqrt(variance)
+    return 0.5 * math.erfc(z / math.sqrt(2.0))
+
+def CompareBenchmarks(baseline_path, results_path, threshold):
+    """Compare les résultats à la référence, faux en cas de régression"""
+    try:
+        with open(baseline_path) as f:
+            baseline = {b["name"]: b for b in json.load(f)["benchmarks"]}
+    except OSError:
+        print("ERREUR: aucune reference " + baseline_path +
+              " (python3 build.py bench --save-baseline)")
+        return False
+    with open(results_path) as f:
+        current = json.load(f)["benchmarks"]
+
+    print("\n" + "=" * 50)
+    print(f"COMPARAISON avec {baseline_path}")
+    print(f"(seuil {threshold * 100:.1f} %, Mann-Whitney p < {BENCH_ALPHA})")
+    print("=" * 50)
+    print(f"  {'Benchmark':32} {'Reference':>12} {'Actuel':>12} {'Ecart':>8} {'p':>8}")
+
+    regressions = []
+    for result in current:
+        reference = baseline.get(result["name"])
+        if reference is None:
+            print(f"  {result['name']:32} (nouveau)")
+            continue
+
+        # Toutes les unités mesurées sont des durées : plus grand = plus lent
+        change = result["median"] / reference["median"] - 1.0 if reference["median"] else 0.0
+        p = MannWhitneyGreater(result["samples"], reference["samples"])
+        tracked = any(result["name"].startswith(t) for t in BENCH_TRACKED)
+
+        verdict = ""
+        if change > threshold and p < BENCH_ALPHA:
+            verdict = "REGRESSION" if tracked else "regression (non suivi)"
+            if tracked:
+                regressions.append(result["name"])
+        elif change < -threshold and MannWhitneyGreater(reference["samples"],
+                                                         result["samples"]) < BENCH_ALPHA:
+            verdict = "amelioration"
+
+        print(f"  {result['name']:32} {reference['median']:12.2f} {result['median']:12.2f} "
+              f"{change * 100:+7.1f}% {p:8.4f}  {verdict}")
+
+    if regressions:
+        print(f"\nECHEC: {len(regressions)} regression(s) : " + ", ".join(regressions))
+        return False
+
+    print("\nAucune regression")
+    return True
+
 if __name__ == "__main__":
-    # Lance la compilation et retourne le code d'erreur approprié
-    sys.exit(0 if Build() else 1)
\ No newline at end of file
+    parser = argparse.ArgumentParser(description="Compilation du Sudoku")
+    parser.add_argument("target", nargs="?", choices=sorted(TARGETS), default="sudoku",
+                        help="cible : le jeu (defaut), bench (compile et "
+                             "lance les benchmarks), cli (outil sudoku-cli) "
+                             "ou core (libsudoku_core.a seule)")
+    parser.add_argument("-j", "--jobs", type=int, default=os.cpu_count() or 1,
+                        help="nombre de compilations en parallele")
+    parser.add_argument("--clean", action="store_true",
+                        help="supprime les objets avant de compiler")
+    parser.add_argument("--config", choices=sorted(CONFIGS),
+                        help="configuration de compilation (defaut: debug, "
+                             "release pour bench)")
+    parser.add_argument("--march", default="",
+                        help="architecture cible, ex. native ou x86-64-v3 "
+                             "(defaut: generique)")
+    parser.add_argument("--no-exceptions-hot", action="store_true",
+                        help="compile " + ", ".join(HOT_SOURCES) +
+                             " sans exceptions ni RTTI")
+    parser.add_argument("--pgo", action="store_true",
+                        help="compilation guidee par profil en deux etapes "
+                             "(build/pgo/ : " + ", ".join(PGO_TARGETS) +
+                             "), avec mesure de l'acceleration")
+    parser.add_argument("--bolt", action="store_true",
+                        help="avec --pgo : applique llvm-bolt a sudoku-cli")
+    parser.add_argument("--unity", action="store_true",
+                        help="build unitaire : un seul fichier pour tout src/")
+    parser.add_argument("--pch", action="store_true",
+                        help="en-tete precompile pour SDL3 et ImGui (" +
+                             PCH_HEADER + ")")
+    parser.add_argument("--measure-build", action="store_true",
+                        help="mesure une compilation complete puis "
+                             "incrementale de la configuration")
+    parser.add_argument("--bench-filter", default="",
+                        help="bench : ne lance que les benchmarks dont le nom "
+                             "contient ce texte")
+    parser.add_argument("--bench-repetitions", type=int, default=0,
+                        help="bench : nombre de repetitions par benchmark")
+    parser.add_argument("--bench-frames", type=int, default=0,
+                        help="bench : frames par repetition des benchmarks "
+                             "de rendu (defaut: 500)")
+    parser.add_argument("--save-baseline", action="store_true",
+                        help="bench : enregistre les resultats comme reference "
+                             "de cette machine (" + BENCH_BASELINE_DIR + "/)")
+    parser.add_argument("--compare", action="store_true",
+                        help="bench : compare a la reference, code de sortie 1 "
+                             "en cas de regression")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="bench --compare : ecart minimal (en %%) pour "
+                             "signaler une regression (defaut: 5)")
+    args = parser.parse_args()
+    args.jobs = max(1, args.jobs)
+    if args.config is None:
+        args.config = "release" if args.target == "bench" else "debug"
+
+    if args.pgo:
+        ok = BuildPGO(args)
+        sys.exit(0 if ok else 1)
+
+    if args.measure_build:
+        ok = MeasureBuild(args.config, args)
+        sys.exit(0 if ok else 1)
+
+    if args.clean:
+        Clean(args.config)
+
+    if args.target == "bench":
+        ok = RunBenchmarks(args.config, args)
+        sys.exit(0 if ok else 1)
+
+    # Lance la compilation et retourne le code d'erreur approprié ; l'outil
+    # en ligne de commande n'est accepté que s'il reproduit les grilles de
+    # référence
+    ok = Build(args.config, args, args.target)
+    if ok and args.target == "cli":
+        ok = CheckGolden(args.config)
+    sys.exit(0 if ok else 1)
@@ -0,0 +1,39 @@
+// ============================================================================
+// Cli.h
+// Outil en ligne de commande (build.py cli) : commandes et options communes
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef CLI_H
+#define CLI_H
+
+// Les grilles circulent au format texte de include/PuzzleText.h : une par
+// ligne, "-" désigne l'entrée ou la sortie standard. Les résultats vont sur
+// la sortie, les bilans et erreurs sur la sortie d'erreur : les commandes
+// s'enchaînent avec des tubes.
+
+// Valeur d'une option "--nom=valeur" : nullptr si "arg" n'est pas cette option
+const char* OptionValue(const char* arg, const char* name);
+
+// Niveau de difficulté par son nom ("facile", "expert"...) ou son numéro.
+// -1 pour "tous", -2 si le texte n'est pas reconnu.
+int ParseDifficulty(const char* text);
+
+// Commandes : arguments qui suivent le nom de la commande. Retournent le
+// code de sortie, ou CLI_USAGE_ERROR pour une option invalide (la syntaxe
+// de la commande est alors rappelée).
+const int CLI_USAGE_ERROR = 2;
+
+int RunGenerate(int argc, char* argv[]);
+int RunBuildDatabase(int argc, char* argv[]);
+int RunFeed(int argc, char* argv[]);
+int RunPuzzle(int argc, char* argv[]);
+int RunGolden(int argc, char* argv[]);
+int RunSolve(int argc, char* argv[]);
+int RunGrade(int argc, char* argv[]);
+int RunValidate(int argc, char* argv[]);
+int RunServe(int argc, char* argv[]);
+int RunLoad(int argc, char* argv[]);
+
+#endif // CLI_H
@@ -0,0 +1,112 @@
+// ============================================================================
+// CliMain.cpp
+// Point d'entrée de l'outil en ligne de commande (sudoku-cli)
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "Cli.h"
+#include "../include/PuzzleGenerator.h"
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+// Commandes disponibles
+struct CliCommand
+{
+    const char* name;
+    int (*run)(int argc, char* argv[]);
+    const char* usage;
+};
+
+static const CliCommand COMMANDS[] = {
+    { "generate", RunGenerate,
+      "generate [--count=N] [--difficulty=niveau] [--seed=N] [--threads=N] [--output=-]" },
+    { "puzzle", RunPuzzle,
+      "puzzle [--number=N | --date=AAAA-MM-JJ | --daily] [--count=N] [--output=-]" },
+    { "golden", RunGolden, "golden" },
+    { "solve", RunSolve, "solve [--input=-] [--output=-]" },
+    { "grade", RunGrade, "grade [--input=-] [--output=-]" },
+    { "validate", RunValidate, "validate [--input=-]" },
+    { "build-db", RunBuildDatabase,
+      "build-db --output=puzzles.db [--count=N] [--seed=N] [--threads=N]" },
+    { "feed", RunFeed,
+      "feed [--ring=/sudoku-puzzles] [--capacity=N] [--difficulty=niveau] [--seed=N] [--threads=N]" },
+    { "serve", RunServe, "serve [--socket=sudoku.sock] [--threads=N] [--seed=N]" },
+    { "load", RunLoad,
+      "load [--socket=sudoku.sock] [--op=generate|solve|grade|hint] [--requests=N]"
+      " [--connections=N] [--pipeline=N] [--input=grilles.txt] [--difficulty=niveau]" }
+};
+
+// ============================================================================
+// Affiche l'aide
+// ============================================================================
+static void PrintUsage(const char* program)
+{
+    std::cerr << "Usage:" << std::endl;
+    for (const CliCommand& command : COMMANDS)
+        std::cerr << "  " << program << " " << command.usage << std::endl;
+    std::cerr << "Niveaux: facile, moyen, difficile, expert (ou 0 a 3), tous" << std::endl;
+    std::cerr << "\"-\" designe l'entree ou la sortie standard" << std::endl;
+}
+
+// ============================================================================
+// Valeur d'une option "--nom=valeur"
+// ============================================================================
+const char* OptionValue(const char* arg, const char* name)
+{
+    size_t length = strlen(name);
+    if (strncmp(arg, name, length) != 0 || arg[length] != '=')
+        return nullptr;
+    return arg + length + 1;
+}
+
+// ============================================================================
+// Niveau de difficulté par son nom ou son numéro (sans tenir compte de la
+// casse)
+// ============================================================================
+int ParseDifficulty(const char* text)
+{
+    if (text[0] >= '0' && text[0] < '0' + DIFFICULTY_COUNT && text[1] == '\0')
+        return text[0] - '0';
+
+    for (int level = -1; level < DIFFICULTY_COUNT; level++)
+    {
+        const char* name = level < 0 ? "tous" : DIFFICULTY_NAMES[level];
+        size_t i = 0;
+        while (text[i] && name[i] && tolower(text[i]) == tolower(name[i]))
+            i++;
+        if (text[i] == '\0' && name[i] == '\0')
+            return level;
+    }
+    return -2;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2 || strcmp(argv[1], "--help") == 0 || strcmp(argv[1], "-h") == 0)
+    {
+        PrintUsage(argv[0]);
+        return argc < 2 ? 1 : 0;
+    }
+
+    for (const CliCommand& command : COMMANDS)
+    {
+        if (strcmp(argv[1], command.name) != 0)
+            continue;
+
+        int result = command.run(argc - 2, argv + 2);
+        if (result == CLI_USAGE_ERROR)
+        {
+            // Option inconnue : rappel de la syntaxe de la commande
+            std::cerr << "Usage: " << argv[0] << " " << command.usage << std::endl;
+            return 1;
+        }
+        return result;
+    }
+
+    std::cerr << "Commande inconnue: " << argv[1] << std::endl;
+    PrintUsage(argv[0]);
+    return 1;
+}
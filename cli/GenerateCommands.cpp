@@ -0,0 +1,388 @@
+// ============================================================================
+// GenerateCommands.cpp
+// Commandes de génération : grilles texte (generate), base binaire
+// (build-db) et anneau partagé (feed)
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "Cli.h"
+#include "../include/FingerprintSet.h"
+#include "../include/PuzzleCanonicalizer.h"
+#include "../include/PuzzleDatabase.h"
+#include "../include/PuzzleGenerator.h"
+#include "../include/PuzzleRing.h"
+#include "../include/PuzzleText.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Grilles produites par thread et par tour : assez pour amortir la création
+// des threads, assez peu pour que la sortie arrive au fil de l'eau
+static const int GENERATE_BATCH = 32;
+
+// Attente du producteur quand l'anneau est plein
+static const std::chrono::milliseconds FEED_FULL_WAIT(5);
+
+// Refus de Push au-delà duquel une case réservée est tenue pour perdue
+// (consommateur tué) : une lecture normale dure quelques microsecondes
+static const std::chrono::seconds FEED_STALL_TIMEOUT(2);
+
+// Arrêt demandé (Ctrl+C) pendant feed
+static volatile std::sig_atomic_t sFeedStop = 0;
+
+static void StopFeed(int)
+{
+    sFeedStop = 1;
+}
+
+// ============================================================================
+// Nombre de threads par défaut : un par cœur
+// ============================================================================
+static int DefaultThreadCount()
+{
+    int threads = static_cast<int>(std::thread::hardware_concurrency());
+    return threads > 0 ? threads : 1;
+}
+
+// ============================================================================
+// generate : grilles minimales à solution unique, une par ligne.
+// La génération avance par tours : chaque thread produit un lot avec son
+// propre générateur (graine + numéro du thread), puis les lots sont écrits
+// dans l'ordre des threads. Les doublons (grilles équivalentes) sont écartés
+// à l'écriture : même graine et même nombre de threads donnent exactement la
+// même sortie.
+// ============================================================================
+int RunGenerate(int argc, char* argv[])
+{
+    unsigned long long count = 1;
+    int difficulty = -1;
+    unsigned int seed = 1;
+    int threads = DefaultThreadCount();
+    std::string outputPath = "-";
+
+    for (int i = 0; i < argc; i++)
+    {
+        const char* value;
+        if ((value = OptionValue(argv[i], "--count")))
+        {
+            count = strtoull(value, nullptr, 10);
+        }
+        else if ((value = OptionValue(argv[i], "--difficulty")))
+        {
+            difficulty = ParseDifficulty(value);
+            if (difficulty == -2)
+            {
+                fprintf(stderr, "Niveau inconnu: %s\n", value);
+                return CLI_USAGE_ERROR;
+            }
+        }
+        else if ((value = OptionValue(argv[i], "--seed")))
+        {
+            seed = static_cast<unsigned int>(strtoul(value, nullptr, 10));
+        }
+        else if ((value = OptionValue(argv[i], "--threads")))
+        {
+            threads = atoi(value);
+        }
+        else if ((value = OptionValue(argv[i], "--output")))
+        {
+            outputPath = value;
+        }
+        else
+        {
+            fprintf(stderr, "Option inconnue: %s\n", argv[i]);
+            return CLI_USAGE_ERROR;
+        }
+    }
+
+    if (threads < 1)
+        threads = 1;
+
+    PuzzleWriter writer;
+    if (!writer.Open(outputPath))
+    {
+        fprintf(stderr, "Impossible d'ecrire %s\n", outputPath.c_str());
+        return 1;
+    }
+
+    // Générateurs conservés d'un tour à l'autre
+    std::vector<PuzzleGenerator> generators;
+    generators.reserve(threads);
+    for (int t = 0; t < threads; t++)
+        generators.emplace_back(seed + t);
+
+    std::vector<std::vector<int>> batches(threads, std::vector<int>(GENERATE_BATCH * CELL_COUNT));
+    FingerprintSet fingerprints(count);
+    PuzzleCanonicalizer canonicalizer;
+    unsigned long long written = 0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    while (written < count)
+    {
+        // Lots de ce tour, limités à ce qu'il reste à produire
+        unsigned long long missing = count - written;
+        int active = static_cast<int>(std::min<unsigned long long>(
+            threads, (missing + GENERATE_BATCH - 1) / GENERATE_BATCH));
+        int batchSize = static_cast<int>(std::min<unsigned long long>(GENERATE_BATCH, missing));
+
+        std::vector<std::thread> workers;
+        for (int t = 0; t < active; t++)
+        {
+            workers.emplace_back([&generators, &batches, t, batchSize, difficulty]() {
+                int* cells = batches[t].data();
+                for (int produced = 0; produced < batchSize;)
+                {
+                    generators[t].Generate(cells);
+                    if (difficulty >= 0 && PuzzleGenerator::Grade(cells) != difficulty)
+                        continue;
+                    cells += CELL_COUNT;
+                    produced++;
+                }
+            });
+        }
+
+        for (std::thread& worker : workers)
+            worker.join();
+
+        for (int t = 0; t < active && written < count; t++)
+        {
+            for (int i = 0; i < batchSize && written < count; i++)
+            {
+                const int* cells = batches[t].data() + i * CELL_COUNT;
+                if (!fingerprints.Insert(canonicalizer.Fingerprint(cells)))
+                    continue;
+                writer.Write(cells);
+                written++;
+            }
+        }
+    }
+
+    if (!writer.Close())
+    {
+        fprintf(stderr, "Echec de l'ecriture de %s\n", outputPath.c_str());
+        return 1;
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    fprintf(stderr, "%llu grilles generees en %.2f s (%d threads, %llu doublons ecartes)\n",
+            written, elapsed.count(), threads,
+            (unsigned long long)fingerprints.GetDuplicateCount());
+    return 0;
+}
+
+// ============================================================================
+// Progression de build-db
+// ============================================================================
+static void PrintBuildProgress(uint64_t done, uint64_t count)
+{
+    fprintf(stderr, "Generation: %llu%%\n", (unsigned long long)(done * 100 / count));
+}
+
+// ============================================================================
+// build-db : base binaire pour le jeu (voir include/PuzzleDatabase.h)
+// ============================================================================
+int RunBuildDatabase(int argc, char* argv[])
+{
+    std::string outputPath;
+    unsigned long long count = 100000;
+    unsigned int seed = 1;
+    int threads = DefaultThreadCount();
+
+    for (int i = 0; i < argc; i++)
+    {
+        const char* value;
+        if ((value = OptionValue(argv[i], "--output")))
+        {
+            outputPath = value;
+        }
+        else if ((value = OptionValue(argv[i], "--count")))
+        {
+            count = strtoull(value, nullptr, 10);
+        }
+        else if ((value = OptionValue(argv[i], "--seed")))
+        {
+            seed = static_cast<unsigned int>(strtoul(value, nullptr, 10));
+        }
+        else if ((value = OptionValue(argv[i], "--threads")))
+        {
+            threads = atoi(value);
+        }
+        else
+        {
+            fprintf(stderr, "Option inconnue: %s\n", argv[i]);
+            return CLI_USAGE_ERROR;
+        }
+    }
+
+    if (outputPath.empty() || outputPath == "-")
+    {
+        fprintf(stderr, "build-db: --output=fichier obligatoire (base projetee en memoire)\n");
+        return CLI_USAGE_ERROR;
+    }
+
+    PuzzleDatabaseBuildStats stats;
+    if (!PuzzleDatabase::Build(outputPath, count, seed, threads, stats, PrintBuildProgress))
+        return 1;
+
+    fprintf(stderr, "Base ecrite: %s (%llu grilles en %.1f s, %llu doublons ecartes, %.4f%%)\n",
+            outputPath.c_str(), (unsigned long long)stats.count, stats.seconds,
+            (unsigned long long)stats.duplicateCount, stats.duplicateRate * 100.0);
+    for (int level = 0; level < DIFFICULTY_COUNT; level++)
+        fprintf(stderr, "  %-10s %llu\n", DIFFICULTY_NAMES[level],
+                (unsigned long long)stats.levelCounts[level]);
+    if (stats.overflowCount > 0)
+        fprintf(stderr, "Table d'empreintes pleine : %llu grilles non dedoublonnees\n",
+                (unsigned long long)stats.overflowCount);
+    return 0;
+}
+
+// ============================================================================
+// feed : remplit l'anneau partagé jusqu'à Ctrl+C. Les threads génèrent en
+// parallèle et publient sous un verrou (l'anneau n'a qu'un producteur) ;
+// anneau plein, ils attendent que les jeux y puisent. Une case jamais rendue
+// (consommateur tué pendant sa lecture) bloque l'anneau : passé
+// FEED_STALL_TIMEOUT, le segment est recréé.
+// ============================================================================
+int RunFeed(int argc, char* argv[])
+{
+    std::string ringName = PUZZLE_RING_DEFAULT_NAME;
+    unsigned long long capacity = 4096;
+    int difficulty = -1;
+    unsigned int seed = 1;
+    int threads = DefaultThreadCount();
+
+    for (int i = 0; i < argc; i++)
+    {
+        const char* value;
+        if ((value = OptionValue(argv[i], "--ring")))
+        {
+            ringName = value;
+        }
+        else if ((value = OptionValue(argv[i], "--capacity")))
+        {
+            capacity = strtoull(value, nullptr, 10);
+        }
+        else if ((value = OptionValue(argv[i], "--difficulty")))
+        {
+            difficulty = ParseDifficulty(value);
+            if (difficulty == -2)
+            {
+                fprintf(stderr, "Niveau inconnu: %s\n", value);
+                return CLI_USAGE_ERROR;
+            }
+        }
+        else if ((value = OptionValue(argv[i], "--seed")))
+        {
+            seed = static_cast<unsigned int>(strtoul(value, nullptr, 10));
+        }
+        else if ((value = OptionValue(argv[i], "--threads")))
+        {
+            threads = atoi(value);
+        }
+        else
+        {
+            fprintf(stderr, "Option inconnue: %s\n", argv[i]);
+            return CLI_USAGE_ERROR;
+        }
+    }
+
+    if (threads < 1)
+        threads = 1;
+
+    PuzzleRing ring;
+    if (!ring.Create(ringName, capacity))
+    {
+        fprintf(stderr, "Impossible de creer l'anneau %s\n", ringName.c_str());
+        return 1;
+    }
+
+    sFeedStop = 0;
+    std::signal(SIGINT, StopFeed);
+    std::signal(SIGTERM, StopFeed);
+    fprintf(stderr, "Anneau %s (%llu cases, %d threads), Ctrl+C pour arreter\n",
+            ringName.c_str(), (unsigned long long)ring.GetCapacity(), threads);
+
+    // Protégés par "producer" : début du blocage en cours, recréations
+    std::mutex producer;
+    bool stalled = false;
+    std::chrono::steady_clock::time_point stalledSince;
+    unsigned long long recreated = 0;
+
+    std::atomic<unsigned long long> published(0);
+    std::vector<std::thread> workers;
+
+    for (int t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&, t]() {
+            PuzzleGenerator generator(seed + t);
+            int cells[CELL_COUNT];
+
+            while (!sFeedStop)
+            {
+                generator.Generate(cells);
+                if (difficulty >= 0 && PuzzleGenerator::Grade(cells) != difficulty)
+                    continue;
+
+                for (;;)
+                {
+                    bool pushed;
+                    {
+                        std::lock_guard<std::mutex> lock(producer);
+                        pushed = ring.Push(cells);
+
+                        // Refusé alors que des cases ont été réservées : la
+                        // case suivante n'a pas encore été rendue
+                        auto now = std::chrono::steady_clock::now();
+                        if (pushed || ring.GetCount() >= ring.GetCapacity())
+                        {
+                            stalled = false;
+                        }
+                        else if (!stalled)
+                        {
+                            stalled = true;
+                            stalledSince = now;
+                        }
+                        else if (now - stalledSince >= FEED_STALL_TIMEOUT)
+                        {
+                            fprintf(stderr, "Case non rendue depuis %lld s, anneau %s recree\n",
+                                    (long long)FEED_STALL_TIMEOUT.count(), ringName.c_str());
+                            stalled = false;
+                            recreated++;
+                            if (!ring.Create(ringName, capacity))
+                            {
+                                fprintf(stderr, "Impossible de recreer l'anneau %s\n",
+                                        ringName.c_str());
+                                sFeedStop = 1;
+                            }
+                        }
+                    }
+                    if (pushed)
+                    {
+                        published.fetch_add(1, std::memory_order_relaxed);
+                        break;
+                    }
+                    if (sFeedStop)
+                        break;
+                    std::this_thread::sleep_for(FEED_FULL_WAIT);
+                }
+            }
+        });
+    }
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    fprintf(stderr, "\n%llu grilles publiees, %llu encore dans l'anneau, %llu recreations\n",
+            published.load(), (unsigned long long)ring.GetCount(), recreated);
+    ring.Close();
+    return 0;
+}
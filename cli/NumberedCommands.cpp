@@ -0,0 +1,224 @@
+// ============================================================================
+// NumberedCommands.cpp
+// Commandes des grilles numérotées : grille n° N ou grille d'un jour
+// (puzzle) et vérification des empreintes de référence (golden)
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "Cli.h"
+#include "../include/PuzzleCanonicalizer.h"
+#include "../include/PuzzleGenerator.h"
+#include "../include/PuzzleRandom.h"
+#include "../include/PuzzleText.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+// Grilles couvertes par l'empreinte de référence
+static const uint64_t GOLDEN_PUZZLE_COUNT = 100;
+
+// Tirages couverts par l'empreinte du générateur pseudo-aléatoire
+static const int GOLDEN_RANDOM_COUNT = 1000;
+
+// Valeurs de référence de PUZZLE_ALGORITHM_VERSION : identiques pour toutes
+// les plateformes, compilateurs et configurations. Une différence signale
+// un changement des grilles produites (voir PuzzleGenerator.h).
+struct GoldenValue
+{
+    const char* name;
+    uint64_t expected;
+};
+
+static const GoldenValue GOLDEN_VALUES[] = {
+    { "tirages (graine 0)", 0xE416BBA9DA8B9755ULL },
+    { "tirages bornes (graine 0)", 0xB0152B383304F73CULL },
+    { "grilles 0 a 99", 0x4BE94420D5A308A0ULL },
+    { "grille du jour 2026-01-01", 0xEB4DAFFC78D21F1AULL },
+    { "jour 2026-01-01", 20454 },
+    { "jour 2000-02-29", 11016 }
+};
+
+// Jour de la grille du jour de référence
+static const char* const GOLDEN_DAY = "2026-01-01";
+
+// ============================================================================
+// Accumule une valeur dans une empreinte
+// ============================================================================
+static uint64_t Combine(uint64_t hash, uint64_t value)
+{
+    return PuzzleRandom::Mix(hash ^ value) + 0x9E3779B97F4A7C15ULL;
+}
+
+// ============================================================================
+// Date "AAAA-MM-JJ" d'un jour (jours depuis le 1er janvier 1970), inverse de
+// PuzzleGenerator::DayNumber
+// ============================================================================
+static std::string DateOfDay(uint64_t day)
+{
+    // Années commençant en mars, par ères de 400 ans
+    int64_t shifted = static_cast<int64_t>(day) + 719468;
+    int64_t era = shifted / 146097;
+    int64_t dayOfEra = shifted - era * 146097;
+    int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    int64_t monthIndex = (5 * dayOfYear + 2) / 153;
+    int dayOfMonth = static_cast<int>(dayOfYear - (153 * monthIndex + 2) / 5 + 1);
+    int month = static_cast<int>(monthIndex < 10 ? monthIndex + 3 : monthIndex - 9);
+    int64_t year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+
+    char text[32];
+    snprintf(text, sizeof(text), "%04lld-%02d-%02d", (long long)year, month, dayOfMonth);
+    return text;
+}
+
+// ============================================================================
+// puzzle : grilles n° N à N + count - 1, ou grilles du jour à partir d'une
+// date. Rien n'est stocké : chaque grille est recalculée depuis son numéro.
+// ============================================================================
+int RunPuzzle(int argc, char* argv[])
+{
+    int64_t number = 0;
+    bool daily = false;
+    unsigned long long count = 1;
+    std::string outputPath = "-";
+
+    for (int i = 0; i < argc; i++)
+    {
+        const char* value;
+        if ((value = OptionValue(argv[i], "--number")))
+        {
+            number = strtoll(value, nullptr, 10);
+            daily = false;
+            if (number < 0)
+            {
+                fprintf(stderr, "Numero de grille invalide: %s\n", value);
+                return CLI_USAGE_ERROR;
+            }
+        }
+        else if ((value = OptionValue(argv[i], "--date")) ||
+                 std::string(argv[i]) == "--daily")
+        {
+            number = PuzzleGenerator::DayNumber(value ? value : "");
+            daily = true;
+            if (number < 0)
+            {
+                fprintf(stderr, "Date invalide (AAAA-MM-JJ): %s\n", value ? value : "");
+                return CLI_USAGE_ERROR;
+            }
+        }
+        else if ((value = OptionValue(argv[i], "--count")))
+        {
+            count = strtoull(value, nullptr, 10);
+        }
+        else if ((value = OptionValue(argv[i], "--output")))
+        {
+            outputPath = value;
+        }
+        else
+        {
+            fprintf(stderr, "Option inconnue: %s\n", argv[i]);
+            return CLI_USAGE_ERROR;
+        }
+    }
+
+    PuzzleWriter writer;
+    if (!writer.Open(outputPath))
+    {
+        fprintf(stderr, "Impossible d'ecrire %s\n", outputPath.c_str());
+        return 1;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    int cells[CELL_COUNT];
+    for (unsigned long long i = 0; i < count; i++)
+    {
+        uint64_t current = static_cast<uint64_t>(number) + i;
+        std::string annotation;
+        if (daily)
+        {
+            PuzzleGenerator::GenerateDaily(current, cells);
+            annotation = DateOfDay(current);
+        }
+        else
+        {
+            PuzzleGenerator::GenerateNumbered(current, cells);
+            annotation = "#" + std::to_string(current);
+        }
+
+        if (!writer.Write(cells, annotation.c_str()))
+        {
+            fprintf(stderr, "Erreur d'ecriture: %s\n", outputPath.c_str());
+            return 1;
+        }
+    }
+
+    double elapsedUs = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count();
+    fprintf(stderr, "%llu grilles (version %u) en %.1f ms, %.0f us par grille\n",
+            count, PUZZLE_ALGORITHM_VERSION, elapsedUs / 1000.0,
+            count > 0 ? elapsedUs / count : 0.0);
+    return 0;
+}
+
+// ============================================================================
+// golden : recalcule les empreintes de référence et les compare. À lancer
+// sur chaque plateforme et configuration de compilation.
+// ============================================================================
+int RunGolden(int argc, char* argv[])
+{
+    if (argc > 0)
+    {
+        fprintf(stderr, "Option inconnue: %s\n", argv[0]);
+        return CLI_USAGE_ERROR;
+    }
+
+    const int VALUE_COUNT = sizeof(GOLDEN_VALUES) / sizeof(GOLDEN_VALUES[0]);
+    uint64_t actual[VALUE_COUNT] = {};
+
+    // Suite brute et tirages bornés (toutes les bornes d'un mélange)
+    PuzzleRandom random(0);
+    for (int i = 0; i < GOLDEN_RANDOM_COUNT; i++)
+        actual[0] = Combine(actual[0], random.Next());
+
+    PuzzleRandom bounded(0);
+    for (int i = 0; i < GOLDEN_RANDOM_COUNT; i++)
+        actual[1] = Combine(actual[1], bounded.Below(static_cast<uint32_t>(i % CELL_COUNT + 1)));
+
+    // Grilles numérotées (tirages, solveur et ordre de retrait)
+    auto start = std::chrono::steady_clock::now();
+    int cells[CELL_COUNT];
+    for (uint64_t number = 0; number < GOLDEN_PUZZLE_COUNT; number++)
+    {
+        PuzzleGenerator::GenerateNumbered(number, cells);
+        actual[2] = Combine(actual[2], PuzzleCanonicalizer::Hash(cells));
+    }
+    double elapsedUs = std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now() - start).count();
+
+    // Grille du jour et calendrier
+    PuzzleGenerator::GenerateDaily(static_cast<uint64_t>(PuzzleGenerator::DayNumber(GOLDEN_DAY)),
+                                   cells);
+    actual[3] = PuzzleCanonicalizer::Hash(cells);
+    actual[4] = static_cast<uint64_t>(PuzzleGenerator::DayNumber("2026-01-01"));
+    actual[5] = static_cast<uint64_t>(PuzzleGenerator::DayNumber("2000-02-29"));
+
+    int failures = 0;
+    for (int i = 0; i < VALUE_COUNT; i++)
+    {
+        bool ok = actual[i] == GOLDEN_VALUES[i].expected;
+        if (!ok)
+            failures++;
+        printf("%-6s %-28s %016llx", ok ? "OK" : "ECHEC", GOLDEN_VALUES[i].name,
+               (unsigned long long)actual[i]);
+        if (!ok)
+            printf(" (attendu %016llx)", (unsigned long long)GOLDEN_VALUES[i].expected);
+        printf("\n");
+    }
+
+    printf("Version %u : %d/%d empreintes conformes, %.0f us par grille\n",
+           PUZZLE_ALGORITHM_VERSION, VALUE_COUNT - failures, VALUE_COUNT,
+           elapsedUs / GOLDEN_PUZZLE_COUNT);
+    return failures == 0 ? 0 : 1;
+}
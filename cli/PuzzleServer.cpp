@@ -0,0 +1,694 @@
+// ============================================================================
+// PuzzleServer.cpp
+// Implémentation du service de grilles (Linux : epoll, eventfd, signalfd)
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "PuzzleServer.h"
+
+#if defined(__linux__)
+
+#include "../include/Log.h"
+#include "../include/PuzzleGenerator.h"
+#include "../include/SudokuSolver.h"
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+static_assert(sizeof(PuzzleMessageHeader) == 12, "En-tete de message inattendu");
+
+// Identifiants epoll réservés (les connexions commencent après)
+static const uint64_t EPOLL_LISTEN = 0;
+static const uint64_t EPOLL_WAKE = 1;
+static const uint64_t EPOLL_SIGNAL = 2;
+static const uint64_t FIRST_CONNECTION = 3;
+
+// Événements traités par appel à epoll_wait
+static const int SERVER_MAX_EVENTS = 64;
+
+// Taille d'une lecture sur une connexion
+static const size_t SERVER_READ_SIZE = 64 * 1024;
+
+// ============================================================================
+// Taille des données d'une requête selon son code (0 = code inconnu)
+// ============================================================================
+static uint32_t RequestPayloadSize(uint8_t opcode)
+{
+    switch (static_cast<PuzzleOpcode>(opcode))
+    {
+        case PuzzleOpcode::Generate: return 1;
+        case PuzzleOpcode::Solve:
+        case PuzzleOpcode::Grade:
+        case PuzzleOpcode::Hint: return CELL_COUNT;
+    }
+    return 0;
+}
+
+// ============================================================================
+// Constructeur
+// ============================================================================
+PuzzleServer::PuzzleServer()
+    : mListenFd(-1), mEpollFd(-1), mWakeFd(-1), mSignalFd(-1),
+      mNextConnection(FIRST_CONNECTION), mStopping(false),
+      mRequestCount(0), mBatchCount(0)
+{
+}
+
+// ============================================================================
+// Destructeur
+// ============================================================================
+PuzzleServer::~PuzzleServer()
+{
+    Stop();
+}
+
+// ============================================================================
+// Crée le socket, la boucle epoll et les threads de calcul
+// ============================================================================
+bool PuzzleServer::Start(const std::string& socketPath, int threads, unsigned int seed)
+{
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(address.sun_path))
+    {
+        LOG_ERROR("Chemin de socket trop long: %s", socketPath.c_str());
+        return false;
+    }
+    memcpy(address.sun_path, socketPath.c_str(), socketPath.size());
+
+    // Les signaux d'arrêt passent par un descripteur lu par la boucle ;
+    // bloqués avant la création des threads, qui en héritent
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    mSignalFd = signalfd(-1, &signals, SFD_NONBLOCK | SFD_CLOEXEC);
+    mWakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    mListenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (mSignalFd < 0 || mWakeFd < 0 || mEpollFd < 0 || mListenFd < 0)
+    {
+        LOG_ERROR("Creation du service impossible: %s", strerror(errno));
+        Stop();
+        return false;
+    }
+
+    unlink(socketPath.c_str());
+    if (bind(mListenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(mListenFd, SOMAXCONN) != 0)
+    {
+        LOG_ERROR("Socket %s indisponible: %s", socketPath.c_str(), strerror(errno));
+        Stop();
+        return false;
+    }
+    mSocketPath = socketPath;
+
+    const int fds[] = { mListenFd, mWakeFd, mSignalFd };
+    const uint64_t ids[] = { EPOLL_LISTEN, EPOLL_WAKE, EPOLL_SIGNAL };
+    for (int i = 0; i < 3; i++)
+    {
+        epoll_event event;
+        event.events = EPOLLIN;
+        event.data.u64 = ids[i];
+        epoll_ctl(mEpollFd, EPOLL_CTL_ADD, fds[i], &event);
+    }
+
+    mStopping = false;
+    for (int t = 0; t < (threads > 0 ? threads : 1); t++)
+        mWorkers.emplace_back(&PuzzleServer::WorkerLoop, this, seed + t);
+
+    return true;
+}
+
+// ============================================================================
+// Thread de calcul : prend les requêtes par lots, publie les réponses d'un
+// lot d'un coup et ne réveille la boucle que si elle n'a rien en attente
+// ============================================================================
+void PuzzleServer::WorkerLoop(unsigned int seed)
+{
+    SudokuSolver solver;
+    PuzzleGenerator generator(seed);
+    std::vector<Job> batch;
+    std::vector<Reply> replies;
+    batch.reserve(SERVER_BATCH_SIZE);
+    replies.reserve(SERVER_BATCH_SIZE);
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mJobMutex);
+            mJobReady.wait(lock, [this]() { return mStopping || !mJobs.empty(); });
+            if (mStopping)
+                return;
+
+            while (!mJobs.empty() && batch.size() < static_cast<size_t>(SERVER_BATCH_SIZE))
+            {
+                batch.push_back(mJobs.front());
+                mJobs.pop_front();
+            }
+        }
+
+        replies.resize(batch.size());
+        for (size_t i = 0; i < batch.size(); i++)
+            Process(batch[i], replies[i], solver, generator);
+
+        bool wake;
+        {
+            std::lock_guard<std::mutex> lock(mReplyMutex);
+            wake = mReplies.empty();
+            mReplies.insert(mReplies.end(), replies.begin(), replies.end());
+        }
+        if (wake)
+        {
+            uint64_t one = 1;
+            if (write(mWakeFd, &one, sizeof(one)) < 0 && errno != EAGAIN)
+                LOG_WARN("Reveil du service impossible: %s", strerror(errno));
+        }
+
+        mRequestCount.fetch_add(batch.size(), std::memory_order_relaxed);
+        mBatchCount.fetch_add(1, std::memory_order_relaxed);
+        batch.clear();
+    }
+}
+
+// ============================================================================
+// Calcule la réponse d'une requête
+// ============================================================================
+void PuzzleServer::Process(const Job& job, Reply& reply, SudokuSolver& solver,
+                           PuzzleGenerator& generator)
+{
+    PuzzleMessageHeader header = job.header;
+    header.status = static_cast<uint8_t>(PuzzleStatus::Ok);
+    uint8_t* payload = reply.message + sizeof(header);
+    uint32_t payloadSize = 0;
+
+    int cells[CELL_COUNT];
+    bool validCells = true;
+    if (RequestPayloadSize(header.opcode) == CELL_COUNT)
+    {
+        for (int i = 0; i < CELL_COUNT; i++)
+        {
+            cells[i] = job.payload[i];
+            validCells = validCells && cells[i] <= GRID_SIZE;
+        }
+    }
+
+    PuzzleStatus status = validCells ? PuzzleStatus::Ok : PuzzleStatus::BadRequest;
+    switch (static_cast<PuzzleOpcode>(header.opcode))
+    {
+        case PuzzleOpcode::Generate:
+        {
+            int difficulty = job.payload[0];
+            if (difficulty != PUZZLE_ANY_DIFFICULTY && difficulty >= DIFFICULTY_COUNT)
+            {
+                status = PuzzleStatus::BadRequest;
+                break;
+            }
+            do
+            {
+                generator.Generate(cells);
+            } while (difficulty != PUZZLE_ANY_DIFFICULTY &&
+                     PuzzleGenerator::Grade(cells) != difficulty);
+
+            for (int i = 0; i < CELL_COUNT; i++)
+                payload[i] = static_cast<uint8_t>(cells[i]);
+            payloadSize = CELL_COUNT;
+            break;
+        }
+
+        case PuzzleOpcode::Solve:
+        {
+            if (status != PuzzleStatus::Ok)
+                break;
+            if (!solver.Solve(cells))
+            {
+                status = PuzzleStatus::NoSolution;
+                break;
+            }
+            for (int i = 0; i < CELL_COUNT; i++)
+                payload[i] = static_cast<uint8_t>(cells[i]);
+            payloadSize = CELL_COUNT;
+            break;
+        }
+
+        case PuzzleOpcode::Grade:
+        {
+            if (status != PuzzleStatus::Ok)
+                break;
+            int level = PuzzleGenerator::Grade(cells);
+            if (level < 0)
+            {
+                status = PuzzleStatus::NotUnique;
+                break;
+            }
+            payload[0] = static_cast<uint8_t>(level);
+            payloadSize = 1;
+            break;
+        }
+
+        case PuzzleOpcode::Hint:
+        {
+            if (status != PuzzleStatus::Ok)
+                break;
+
+            // Case vide la plus contrainte (celle que le joueur peut déduire
+            // le plus facilement), chiffre pris dans la solution
+            unsigned short used[3][GRID_SIZE] = {};
+            for (int i = 0; i < CELL_COUNT; i++)
+            {
+                if (cells[i] == 0)
+                    continue;
+                unsigned short bit = static_cast<unsigned short>(1 << (cells[i] - 1));
+                used[0][i / GRID_SIZE] |= bit;
+                used[1][i % GRID_SIZE] |= bit;
+                used[2][(i / GRID_SIZE / 3) * 3 + (i % GRID_SIZE) / 3] |= bit;
+            }
+
+            int best = -1;
+            int bestCandidates = GRID_SIZE + 1;
+            for (int i = 0; i < CELL_COUNT; i++)
+            {
+                if (cells[i] != 0)
+                    continue;
+                unsigned short mask = used[0][i / GRID_SIZE] | used[1][i % GRID_SIZE] |
+                                      used[2][(i / GRID_SIZE / 3) * 3 + (i % GRID_SIZE) / 3];
+                int candidates = GRID_SIZE - __builtin_popcount(mask);
+                if (candidates < bestCandidates)
+                {
+                    best = i;
+                    bestCandidates = candidates;
+                }
+            }
+
+            // Grille déjà complète : rien à indiquer
+            if (best < 0)
+            {
+                status = PuzzleStatus::BadRequest;
+                break;
+            }
+            if (!solver.Solve(cells))
+            {
+                status = PuzzleStatus::NoSolution;
+                break;
+            }
+            payload[0] = static_cast<uint8_t>(best);
+            payload[1] = static_cast<uint8_t>(cells[best]);
+            payloadSize = 2;
+            break;
+        }
+
+        default:
+            status = PuzzleStatus::BadRequest;
+            break;
+    }
+
+    if (status != PuzzleStatus::Ok)
+        payloadSize = 0;
+
+    header.status = static_cast<uint8_t>(status);
+    header.length = PuzzleMessageLength(payloadSize);
+    memcpy(reply.message, &header, sizeof(header));
+    reply.size = sizeof(header) + payloadSize;
+    reply.connection = job.connection;
+}
+
+// ============================================================================
+// Boucle principale
+// ============================================================================
+void PuzzleServer::Run()
+{
+    epoll_event events[SERVER_MAX_EVENTS];
+
+    for (;;)
+    {
+        int count = epoll_wait(mEpollFd, events, SERVER_MAX_EVENTS, -1);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            LOG_ERROR("epoll_wait: %s", strerror(errno));
+            return;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            uint64_t id = events[i].data.u64;
+            if (id == EPOLL_SIGNAL)
+                return;
+
+            if (id == EPOLL_LISTEN)
+            {
+                Accept();
+            }
+            else if (id == EPOLL_WAKE)
+            {
+                uint64_t value;
+                if (read(mWakeFd, &value, sizeof(value)) > 0)
+                    DeliverReplies();
+            }
+            else
+            {
+                std::unordered_map<uint64_t, Connection>::iterator it = mConnections.find(id);
+                if (it == mConnections.end())
+                    continue;
+
+                if (events[i].events & (EPOLLERR | EPOLLHUP))
+                {
+                    CloseConnection(id);
+                    continue;
+                }
+                if ((events[i].events & EPOLLOUT) && !WriteTo(it->second))
+                {
+                    CloseConnection(id);
+                    continue;
+                }
+                if (events[i].events & EPOLLIN)
+                    ReadFrom(id);
+                else
+                    ParseInput(id, it->second);
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Accepte les connexions en attente
+// ============================================================================
+void PuzzleServer::Accept()
+{
+    for (;;)
+    {
+        int fd = accept4(mListenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                LOG_WARN("accept: %s", strerror(errno));
+            return;
+        }
+
+        uint64_t id = mNextConnection++;
+        Connection& connection = mConnections[id];
+        connection.fd = fd;
+        connection.outputSent = 0;
+        connection.inFlight = 0;
+        connection.inputClosed = false;
+        connection.events = EPOLLIN;
+
+        epoll_event event;
+        event.events = EPOLLIN;
+        event.data.u64 = id;
+        epoll_ctl(mEpollFd, EPOLL_CTL_ADD, fd, &event);
+    }
+}
+
+// ============================================================================
+// Connexion sous les limites de requêtes en cours et de réponses non envoyées
+// ============================================================================
+bool PuzzleServer::AcceptsRequests(const Connection& connection)
+{
+    return connection.inFlight < SERVER_MAX_IN_FLIGHT &&
+           connection.output.size() - connection.outputSent < SERVER_MAX_PENDING_OUTPUT;
+}
+
+// ============================================================================
+// Lit ce qui est disponible sur une connexion (dans la limite des octets en
+// attente) et découpe les requêtes
+// ============================================================================
+void PuzzleServer::ReadFrom(uint64_t id)
+{
+    Connection& connection = mConnections[id];
+    uint8_t buffer[SERVER_READ_SIZE];
+
+    for (;;)
+    {
+        ssize_t count = recv(connection.fd, buffer, sizeof(buffer), 0);
+        if (count > 0)
+            connection.input.insert(connection.input.end(), buffer, buffer + count);
+
+        // Fin de lecture : les requêtes déjà reçues sont traitées et leurs
+        // réponses envoyées avant la fermeture (voir ParseInput)
+        if (count == 0)
+        {
+            connection.inputClosed = true;
+            break;
+        }
+        if (count < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+        {
+            CloseConnection(id);
+            return;
+        }
+        if (count < 0)
+            break;
+
+        // Assez de travail en attente : le reste restera dans le socket
+        if (!AcceptsRequests(connection) || connection.input.size() >= SERVER_MAX_PENDING_INPUT)
+            break;
+    }
+
+    ParseInput(id, connection);
+}
+
+// ============================================================================
+// Découpe les requêtes complètes et les confie aux threads de calcul, toutes
+// sous un seul verrou
+// ============================================================================
+void PuzzleServer::ParseInput(uint64_t id, Connection& connection)
+{
+    std::vector<Job> jobs;
+    size_t offset = 0;
+    bool protocolError = false;
+
+    while (connection.inFlight + static_cast<int>(jobs.size()) < SERVER_MAX_IN_FLIGHT &&
+           connection.output.size() - connection.outputSent < SERVER_MAX_PENDING_OUTPUT &&
+           connection.input.size() - offset >= sizeof(uint32_t))
+    {
+        uint32_t length;
+        memcpy(&length, connection.input.data() + offset, sizeof(length));
+        if (length < PuzzleMessageLength(0) || length > PuzzleMessageLength(PUZZLE_MAX_PAYLOAD))
+        {
+            protocolError = true;
+            break;
+        }
+        if (connection.input.size() - offset < sizeof(uint32_t) + length)
+            break;
+
+        Job job;
+        job.connection = id;
+        memcpy(&job.header, connection.input.data() + offset, sizeof(job.header));
+        uint32_t payloadSize = length - PuzzleMessageLength(0);
+        memcpy(job.payload, connection.input.data() + offset + sizeof(job.header), payloadSize);
+        offset += sizeof(uint32_t) + length;
+
+        // Code inconnu ou mauvaise taille : réponse immédiate, sans calcul
+        if (payloadSize != RequestPayloadSize(job.header.opcode) || payloadSize == 0)
+        {
+            PuzzleMessageHeader header = job.header;
+            header.length = PuzzleMessageLength(0);
+            header.status = static_cast<uint8_t>(PuzzleStatus::BadRequest);
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&header);
+            connection.output.insert(connection.output.end(), bytes, bytes + sizeof(header));
+            continue;
+        }
+
+        jobs.push_back(job);
+    }
+
+    connection.input.erase(connection.input.begin(), connection.input.begin() + offset);
+    if (protocolError)
+    {
+        LOG_WARN("Message invalide, connexion fermee");
+        CloseConnection(id);
+        return;
+    }
+
+    if (!jobs.empty())
+    {
+        connection.inFlight += static_cast<int>(jobs.size());
+        {
+            std::lock_guard<std::mutex> lock(mJobMutex);
+            mJobs.insert(mJobs.end(), jobs.begin(), jobs.end());
+        }
+        if (jobs.size() > 1)
+            mJobReady.notify_all();
+        else
+            mJobReady.notify_one();
+    }
+
+    if (!WriteTo(connection))
+    {
+        CloseConnection(id);
+        return;
+    }
+
+    // Client qui a fini d'écrire : fermée quand tout est répondu (sans
+    // requête en cours ni réponse en attente, les limites ne retiennent
+    // plus rien ; ce qui reste reçu est une requête incomplète)
+    if (connection.inputClosed && connection.inFlight == 0 &&
+        connection.outputSent >= connection.output.size())
+    {
+        CloseConnection(id);
+        return;
+    }
+    UpdateEvents(id, connection);
+}
+
+// ============================================================================
+// Range les réponses prêtes dans les connexions puis les envoie
+// ============================================================================
+void PuzzleServer::DeliverReplies()
+{
+    std::vector<Reply> replies;
+    {
+        std::lock_guard<std::mutex> lock(mReplyMutex);
+        replies.swap(mReplies);
+    }
+
+    std::vector<uint64_t> touched;
+    for (const Reply& reply : replies)
+    {
+        std::unordered_map<uint64_t, Connection>::iterator it = mConnections.find(reply.connection);
+        if (it == mConnections.end())
+            continue; // Client parti entre-temps
+
+        Connection& connection = it->second;
+        connection.output.insert(connection.output.end(), reply.message, reply.message + reply.size);
+        connection.inFlight--;
+        touched.push_back(reply.connection);
+    }
+
+    std::sort(touched.begin(), touched.end());
+    touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+
+    // Envoi, et reprise des requêtes déjà reçues mais retenues par la limite
+    for (uint64_t id : touched)
+        ParseInput(id, mConnections[id]);
+}
+
+// ============================================================================
+// Envoie ce qui peut l'être sans bloquer. Faux si la connexion est perdue.
+// ============================================================================
+bool PuzzleServer::WriteTo(Connection& connection)
+{
+    while (connection.outputSent < connection.output.size())
+    {
+        ssize_t count = send(connection.fd, connection.output.data() + connection.outputSent,
+                             connection.output.size() - connection.outputSent, MSG_NOSIGNAL);
+        if (count < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                // Client lent : libère la partie déjà envoyée
+                if (connection.outputSent >= connection.output.size() / 2)
+                {
+                    connection.output.erase(connection.output.begin(),
+                                            connection.output.begin() + connection.outputSent);
+                    connection.outputSent = 0;
+                }
+                return true;
+            }
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        connection.outputSent += count;
+    }
+
+    connection.output.clear();
+    connection.outputSent = 0;
+    return true;
+}
+
+// ============================================================================
+// Lecture seulement sous les limites de requêtes en cours, de réponses non
+// envoyées et d'octets reçus (et jusqu'à la fin de lecture), écriture
+// seulement s'il reste des octets à envoyer
+// ============================================================================
+void PuzzleServer::UpdateEvents(uint64_t id, Connection& connection)
+{
+    uint32_t events = 0;
+    if (!connection.inputClosed && AcceptsRequests(connection) &&
+        connection.input.size() < SERVER_MAX_PENDING_INPUT)
+        events |= EPOLLIN;
+    if (connection.outputSent < connection.output.size())
+        events |= EPOLLOUT;
+
+    if (events == connection.events)
+        return;
+
+    epoll_event event;
+    event.events = events;
+    event.data.u64 = id;
+    epoll_ctl(mEpollFd, EPOLL_CTL_MOD, connection.fd, &event);
+    connection.events = events;
+}
+
+// ============================================================================
+// Ferme une connexion (ses réponses en cours seront ignorées)
+// ============================================================================
+void PuzzleServer::CloseConnection(uint64_t id)
+{
+    std::unordered_map<uint64_t, Connection>::iterator it = mConnections.find(id);
+    if (it == mConnections.end())
+        return;
+
+    epoll_ctl(mEpollFd, EPOLL_CTL_DEL, it->second.fd, nullptr);
+    close(it->second.fd);
+    mConnections.erase(it);
+}
+
+// ============================================================================
+// Arrête le service
+// ============================================================================
+void PuzzleServer::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mJobMutex);
+        mStopping = true;
+        mJobs.clear();
+    }
+    mJobReady.notify_all();
+    for (std::thread& worker : mWorkers)
+        worker.join();
+    mWorkers.clear();
+
+    while (!mConnections.empty())
+        CloseConnection(mConnections.begin()->first);
+
+    const int fds[] = { mListenFd, mEpollFd, mWakeFd, mSignalFd };
+    for (int fd : fds)
+    {
+        if (fd >= 0)
+            close(fd);
+    }
+    mListenFd = mEpollFd = mWakeFd = mSignalFd = -1;
+
+    if (!mSocketPath.empty())
+        unlink(mSocketPath.c_str());
+    mSocketPath.clear();
+}
+
+// ============================================================================
+// Statistiques
+// ============================================================================
+uint64_t PuzzleServer::GetRequestCount() const
+{
+    return mRequestCount.load(std::memory_order_relaxed);
+}
+
+uint64_t PuzzleServer::GetBatchCount() const
+{
+    return mBatchCount.load(std::memory_order_relaxed);
+}
+
+#endif // __linux__
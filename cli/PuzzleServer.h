@@ -0,0 +1,139 @@
+// ============================================================================
+// PuzzleServer.h
+// Service de grilles sur socket Unix (sudoku-cli serve) : boucle epoll,
+// requêtes en pipeline, threads de calcul qui traitent les requêtes par lots
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef PUZZLESERVER_H
+#define PUZZLESERVER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "../include/PuzzleProtocol.h"
+
+class PuzzleGenerator;  // Déclarations forward
+class SudokuSolver;
+
+// Requêtes prises d'un coup par un thread de calcul (un seul verrou et un
+// seul réveil de la boucle pour tout le lot)
+const int SERVER_BATCH_SIZE = 64;
+
+// Requêtes en cours par connexion (confiées aux threads de calcul)
+const int SERVER_MAX_IN_FLIGHT = 1024;
+
+// Octets reçus pas encore découpés, et réponses pas encore envoyées, par
+// connexion. Au-delà de l'une de ces limites ou de SERVER_MAX_IN_FLIGHT, la
+// connexion n'est plus lue ni découpée jusqu'à ce que le client lise ses
+// réponses : un client qui envoie sans lire ne remplit pas la mémoire du
+// serveur.
+const size_t SERVER_MAX_PENDING_INPUT = SERVER_MAX_IN_FLIGHT * PUZZLE_MAX_MESSAGE;
+const size_t SERVER_MAX_PENDING_OUTPUT = SERVER_MAX_IN_FLIGHT * PUZZLE_MAX_MESSAGE;
+
+class PuzzleServer
+{
+private:
+    // Requête complète, en attente d'un thread de calcul
+    struct Job
+    {
+        uint64_t connection;
+        PuzzleMessageHeader header;
+        uint8_t payload[PUZZLE_MAX_PAYLOAD];
+    };
+
+    // Réponse encodée, en attente d'envoi par la boucle
+    struct Reply
+    {
+        uint64_t connection;
+        uint32_t size;
+        uint8_t message[PUZZLE_MAX_MESSAGE];
+    };
+
+    struct Connection
+    {
+        int fd;
+        std::vector<uint8_t> input;     // Octets reçus, pas encore découpés
+        std::vector<uint8_t> output;    // Réponses pas encore envoyées
+        size_t outputSent;
+        int inFlight;                   // Requêtes confiées aux threads
+        bool inputClosed;               // Fin de lecture (shutdown du client) :
+                                        // fermée une fois tout répondu
+        uint32_t events;                // Événements epoll demandés
+    };
+
+    int mListenFd;
+    int mEpollFd;
+    int mWakeFd;                // eventfd : réponses prêtes
+    int mSignalFd;              // SIGINT / SIGTERM
+    std::string mSocketPath;
+
+    // Connexions par identifiant (jamais réutilisé, contrairement aux fd)
+    std::unordered_map<uint64_t, Connection> mConnections;
+    uint64_t mNextConnection;
+
+    // File des requêtes
+    std::mutex mJobMutex;
+    std::condition_variable mJobReady;
+    std::deque<Job> mJobs;
+    bool mStopping;
+
+    // Réponses prêtes
+    std::mutex mReplyMutex;
+    std::vector<Reply> mReplies;
+
+    std::vector<std::thread> mWorkers;
+
+    // Statistiques
+    std::atomic<uint64_t> mRequestCount;
+    std::atomic<uint64_t> mBatchCount;
+
+    // Thread de calcul
+    void WorkerLoop(unsigned int seed);
+
+    // Calcule la réponse d'une requête
+    static void Process(const Job& job, Reply& reply, SudokuSolver& solver,
+                        PuzzleGenerator& generator);
+
+    // Boucle : nouvelles connexions, lecture, réponses, écriture
+    void Accept();
+    static bool AcceptsRequests(const Connection& connection);
+    void ReadFrom(uint64_t id);
+    void ParseInput(uint64_t id, Connection& connection);
+    void DeliverReplies();
+    bool WriteTo(Connection& connection);
+    void UpdateEvents(uint64_t id, Connection& connection);
+    void CloseConnection(uint64_t id);
+
+public:
+    // Constructeur et destructeur (le destructeur arrête le service)
+    PuzzleServer();
+    ~PuzzleServer();
+
+    PuzzleServer(const PuzzleServer&) = delete;
+    PuzzleServer& operator=(const PuzzleServer&) = delete;
+
+    // Crée le socket (un fichier existant est remplacé) et lance "threads"
+    // threads de calcul. SIGINT et SIGTERM sont bloqués dans le processus :
+    // ils ne servent plus qu'à arrêter Run().
+    bool Start(const std::string& socketPath, int threads, unsigned int seed);
+
+    // Sert les clients jusqu'à SIGINT ou SIGTERM
+    void Run();
+
+    // Arrête les threads, ferme les connexions et supprime le socket
+    void Stop();
+
+    // Requêtes traitées et lots (prises de la file par un thread)
+    uint64_t GetRequestCount() const;
+    uint64_t GetBatchCount() const;
+};
+
+#endif // PUZZLESERVER_H
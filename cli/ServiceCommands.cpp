@@ -0,0 +1,413 @@
+// ============================================================================
+// ServiceCommands.cpp
+// Commandes du service de grilles : serve (démon sur socket Unix) et load
+// (générateur de charge : requêtes/s et latences p50/p99)
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "Cli.h"
+#include "PuzzleServer.h"
+#include "../include/PuzzleGenerator.h"
+#include "../include/PuzzleText.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+// Socket par défaut (dossier courant)
+static const char* const DEFAULT_SOCKET = "sudoku.sock";
+
+// Grilles générées pour la charge quand aucun fichier n'est donné
+static const int LOAD_PUZZLE_COUNT = 256;
+
+#if defined(__linux__)
+
+// ============================================================================
+// serve : sert les requêtes jusqu'à Ctrl+C (ou SIGTERM)
+// ============================================================================
+int RunServe(int argc, char* argv[])
+{
+    std::string socketPath = DEFAULT_SOCKET;
+    int threads = static_cast<int>(std::thread::hardware_concurrency());
+    unsigned int seed = 1;
+
+    for (int i = 0; i < argc; i++)
+    {
+        const char* value;
+        if ((value = OptionValue(argv[i], "--socket")))
+        {
+            socketPath = value;
+        }
+        else if ((value = OptionValue(argv[i], "--threads")))
+        {
+            threads = atoi(value);
+        }
+        else if ((value = OptionValue(argv[i], "--seed")))
+        {
+            seed = static_cast<unsigned int>(strtoul(value, nullptr, 10));
+        }
+        else
+        {
+            fprintf(stderr, "Option inconnue: %s\n", argv[i]);
+            return CLI_USAGE_ERROR;
+        }
+    }
+
+    if (threads < 1)
+        threads = 1;
+
+    PuzzleServer server;
+    if (!server.Start(socketPath, threads, seed))
+        return 1;
+
+    fprintf(stderr, "Service pret sur %s (%d threads), Ctrl+C pour arreter\n",
+            socketPath.c_str(), threads);
+    server.Run();
+    server.Stop();
+
+    uint64_t requests = server.GetRequestCount();
+    uint64_t batches = server.GetBatchCount();
+    fprintf(stderr, "Service arrete: %llu requetes en %llu lots (%.1f par lot)\n",
+            (unsigned long long)requests, (unsigned long long)batches,
+            batches > 0 ? static_cast<double>(requests) / batches : 0.0);
+    return 0;
+}
+
+// ============================================================================
+// Connexion au service. -1 en cas d'échec.
+// ============================================================================
+static int ConnectTo(const std::string& socketPath)
+{
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(address.sun_path))
+        return -1;
+    memcpy(address.sun_path, socketPath.c_str(), socketPath.size());
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd >= 0 && connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        close(fd);
+        fd = -1;
+    }
+    return fd;
+}
+
+// Résultat d'une connexion du générateur de charge
+struct LoadResult
+{
+    std::vector<double> latencies;      // µs par requête
+    unsigned long long errors = 0;      // Réponses dont le statut n'est pas Ok
+    bool failed = false;                // Connexion perdue
+};
+
+// ============================================================================
+// Une connexion : garde "pipeline" requêtes en cours jusqu'à "quota"
+// réponses. Les requêtes à envoyer après un lot de réponses partent en une
+// seule écriture. Envoi et lecture sont non bloquants et alternés par poll :
+// le serveur cesse de lire une connexion dont il retient trop de requêtes
+// ou de réponses, un envoi bloquant de tout le pipeline se figerait.
+// ============================================================================
+static void RunLoadConnection(const std::string& socketPath, PuzzleOpcode opcode,
+                              uint8_t difficulty, const std::vector<uint8_t>& puzzles,
+                              unsigned long long quota, int pipeline, LoadResult& result)
+{
+    int fd = ConnectTo(socketPath);
+    if (fd < 0)
+    {
+        result.failed = true;
+        return;
+    }
+
+    typedef std::chrono::steady_clock Clock;
+    std::vector<Clock::time_point> sentAt(quota);
+    result.latencies.reserve(quota);
+
+    size_t puzzleCount = puzzles.size() / CELL_COUNT;
+    unsigned long long sent = 0;
+    unsigned long long received = 0;
+    std::vector<uint8_t> output;
+    size_t outputSent = 0;
+    std::vector<uint8_t> input;
+    uint8_t buffer[64 * 1024];
+
+    // Ajoute la requête "sent" au tampon d'envoi
+    auto queueRequest = [&]() {
+        uint32_t payloadSize = opcode == PuzzleOpcode::Generate ? 1 : CELL_COUNT;
+        PuzzleMessageHeader header;
+        header.length = PuzzleMessageLength(payloadSize);
+        header.opcode = static_cast<uint8_t>(opcode);
+        header.status = 0;
+        header.reserved = 0;
+        header.requestId = static_cast<uint32_t>(sent);
+
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&header);
+        output.insert(output.end(), bytes, bytes + sizeof(header));
+        if (opcode == PuzzleOpcode::Generate)
+        {
+            output.push_back(difficulty);
+        }
+        else
+        {
+            const uint8_t* cells = puzzles.data() + (sent % puzzleCount) * CELL_COUNT;
+            output.insert(output.end(), cells, cells + CELL_COUNT);
+        }
+        sentAt[sent] = Clock::now();
+        sent++;
+    };
+
+    while (received < quota)
+    {
+        // Complète le pipeline
+        while (sent < quota && sent - received < static_cast<unsigned long long>(pipeline))
+            queueRequest();
+
+        pollfd entry;
+        entry.fd = fd;
+        entry.events = POLLIN;
+        if (outputSent < output.size())
+            entry.events |= POLLOUT;
+        entry.revents = 0;
+        if (poll(&entry, 1, -1) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        if (entry.revents & POLLOUT)
+        {
+            ssize_t count = send(fd, output.data() + outputSent, output.size() - outputSent,
+                                 MSG_NOSIGNAL | MSG_DONTWAIT);
+            if (count < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                break;
+            if (count > 0)
+                outputSent += count;
+            if (outputSent == output.size())
+            {
+                output.clear();
+                outputSent = 0;
+            }
+        }
+        if (!(entry.revents & (POLLIN | POLLHUP | POLLERR)))
+            continue;
+
+        ssize_t count = recv(fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+        if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+            continue;
+        if (count <= 0)
+            break;
+        input.insert(input.end(), buffer, buffer + count);
+
+        // Réponses complètes
+        Clock::time_point now = Clock::now();
+        size_t offset = 0;
+        while (input.size() - offset >= sizeof(PuzzleMessageHeader))
+        {
+            PuzzleMessageHeader header;
+            memcpy(&header, input.data() + offset, sizeof(header));
+            if (input.size() - offset < sizeof(uint32_t) + header.length)
+                break;
+            offset += sizeof(uint32_t) + header.length;
+
+            if (header.requestId < quota)
+            {
+                std::chrono::duration<double, std::micro> latency = now - sentAt[header.requestId];
+                result.latencies.push_back(latency.count());
+            }
+            if (header.status != static_cast<uint8_t>(PuzzleStatus::Ok))
+                result.errors++;
+            received++;
+        }
+        input.erase(input.begin(), input.begin() + offset);
+    }
+
+    result.failed = received < quota;
+    close(fd);
+}
+
+// ============================================================================
+// Percentile (rang le plus proche) d'échantillons triés
+// ============================================================================
+static double Percentile(const std::vector<double>& sorted, double fraction)
+{
+    size_t rank = static_cast<size_t>(std::ceil(fraction * sorted.size()));
+    return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+// ============================================================================
+// load : générateur de charge pour "serve". Chaque connexion est un thread
+// qui garde --pipeline requêtes en cours.
+// ============================================================================
+int RunLoad(int argc, char* argv[])
+{
+    std::string socketPath = DEFAULT_SOCKET;
+    std::string inputPath;
+    int connections = 4;
+    int pipeline = 32;
+    unsigned long long requests = 100000;
+    PuzzleOpcode opcode = PuzzleOpcode::Solve;
+    int difficulty = -1;
+
+    for (int i = 0; i < argc; i++)
+    {
+        const char* value;
+        if ((value = OptionValue(argv[i], "--socket")))
+        {
+            socketPath = value;
+        }
+        else if ((value = OptionValue(argv[i], "--connections")))
+        {
+            connections = atoi(value);
+        }
+        else if ((value = OptionValue(argv[i], "--pipeline")))
+        {
+            pipeline = atoi(value);
+        }
+        else if ((value = OptionValue(argv[i], "--requests")))
+        {
+            requests = strtoull(value, nullptr, 10);
+        }
+        else if ((value = OptionValue(argv[i], "--input")))
+        {
+            inputPath = value;
+        }
+        else if ((value = OptionValue(argv[i], "--difficulty")))
+        {
+            difficulty = ParseDifficulty(value);
+            if (difficulty == -2)
+            {
+                fprintf(stderr, "Niveau inconnu: %s\n", value);
+                return CLI_USAGE_ERROR;
+            }
+        }
+        else if ((value = OptionValue(argv[i], "--op")))
+        {
+            static const char* const NAMES[] = { "generate", "solve", "grade", "hint" };
+            static const PuzzleOpcode OPCODES[] = { PuzzleOpcode::Generate, PuzzleOpcode::Solve,
+                                                    PuzzleOpcode::Grade, PuzzleOpcode::Hint };
+            int found = -1;
+            for (int n = 0; n < 4; n++)
+            {
+                if (strcmp(value, NAMES[n]) == 0)
+                    found = n;
+            }
+            if (found < 0)
+            {
+                fprintf(stderr, "Operation inconnue: %s\n", value);
+                return CLI_USAGE_ERROR;
+            }
+            opcode = OPCODES[found];
+        }
+        else
+        {
+            fprintf(stderr, "Option inconnue: %s\n", argv[i]);
+            return CLI_USAGE_ERROR;
+        }
+    }
+
+    if (connections < 1)
+        connections = 1;
+    if (pipeline < 1)
+        pipeline = 1;
+
+    // Grilles envoyées en boucle (solve, grade, hint)
+    std::vector<uint8_t> puzzles;
+    int cells[CELL_COUNT];
+    if (!inputPath.empty())
+    {
+        PuzzleReader reader;
+        if (!reader.Open(inputPath))
+        {
+            fprintf(stderr, "Impossible de lire %s\n", inputPath.c_str());
+            return 1;
+        }
+        while (reader.Next(cells))
+            puzzles.insert(puzzles.end(), cells, cells + CELL_COUNT);
+    }
+    else
+    {
+        PuzzleGenerator generator(1);
+        for (int i = 0; i < LOAD_PUZZLE_COUNT; i++)
+        {
+            generator.Generate(cells);
+            puzzles.insert(puzzles.end(), cells, cells + CELL_COUNT);
+        }
+    }
+    if (puzzles.empty())
+    {
+        fprintf(stderr, "Aucune grille dans %s\n", inputPath.c_str());
+        return 1;
+    }
+
+    uint8_t difficultyByte = difficulty < 0 ? PUZZLE_ANY_DIFFICULTY : static_cast<uint8_t>(difficulty);
+    std::vector<LoadResult> results(connections);
+    std::vector<std::thread> threads;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int c = 0; c < connections; c++)
+    {
+        unsigned long long quota = requests / connections +
+                                   (static_cast<unsigned long long>(c) < requests % connections ? 1 : 0);
+        threads.emplace_back(RunLoadConnection, std::cref(socketPath), opcode, difficultyByte,
+                             std::cref(puzzles), quota, pipeline, std::ref(results[c]));
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::vector<double> latencies;
+    unsigned long long errors = 0;
+    bool failed = false;
+    for (const LoadResult& result : results)
+    {
+        latencies.insert(latencies.end(), result.latencies.begin(), result.latencies.end());
+        errors += result.errors;
+        failed = failed || result.failed;
+    }
+
+    if (failed)
+        fprintf(stderr, "Connexion au service %s perdue ou impossible\n", socketPath.c_str());
+    if (latencies.empty())
+        return 1;
+
+    std::sort(latencies.begin(), latencies.end());
+    printf("%zu requetes en %.2f s : %.0f requetes/s (%d connexions, pipeline %d)\n",
+           latencies.size(), elapsed.count(), latencies.size() / elapsed.count(),
+           connections, pipeline);
+    printf("latence (us) : p50 %.1f, p99 %.1f, max %.1f\n",
+           Percentile(latencies, 0.50), Percentile(latencies, 0.99), latencies.back());
+    printf("erreurs : %llu\n", errors);
+    return failed ? 1 : 0;
+}
+
+#else
+
+int RunServe(int argc, char* argv[])
+{
+    fprintf(stderr, "serve: disponible sous Linux seulement (epoll)\n");
+    return 1;
+}
+
+int RunLoad(int argc, char* argv[])
+{
+    fprintf(stderr, "load: disponible sous Linux seulement\n");
+    return 1;
+}
+
+#endif // __linux__
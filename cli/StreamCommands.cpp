@@ -0,0 +1,194 @@
+// ============================================================================
+// StreamCommands.cpp
+// Commandes de traitement d'un flux de grilles : solve, grade, validate
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "Cli.h"
+#include "../include/PuzzleGenerator.h"
+#include "../include/PuzzleText.h"
+#include "../include/SudokuSolver.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+// ============================================================================
+// Options communes : fichier d'entrée et de sortie ("-" par défaut).
+// Faux si une option est inconnue ("outputPath" nul : pas de sortie).
+// ============================================================================
+static bool ParseStreamOptions(int argc, char* argv[], std::string& inputPath,
+                               std::string* outputPath)
+{
+    for (int i = 0; i < argc; i++)
+    {
+        const char* value;
+        if ((value = OptionValue(argv[i], "--input")))
+        {
+            inputPath = value;
+        }
+        else if (outputPath && (value = OptionValue(argv[i], "--output")))
+        {
+            *outputPath = value;
+        }
+        else
+        {
+            fprintf(stderr, "Option inconnue: %s\n", argv[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// Ouvre l'entrée et, si demandé, la sortie
+// ============================================================================
+static bool OpenStreams(PuzzleReader& reader, const std::string& inputPath,
+                        PuzzleWriter* writer, const std::string& outputPath)
+{
+    if (!reader.Open(inputPath))
+    {
+        fprintf(stderr, "Impossible de lire %s\n", inputPath.c_str());
+        return false;
+    }
+    if (writer && !writer->Open(outputPath))
+    {
+        fprintf(stderr, "Impossible d'ecrire %s\n", outputPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// solve : écrit la solution de chaque grille. Une grille sans solution est
+// signalée (numéro de ligne) et n'a pas de ligne en sortie.
+// ============================================================================
+int RunSolve(int argc, char* argv[])
+{
+    std::string inputPath = "-";
+    std::string outputPath = "-";
+    if (!ParseStreamOptions(argc, argv, inputPath, &outputPath))
+        return CLI_USAGE_ERROR;
+
+    PuzzleReader reader;
+    PuzzleWriter writer;
+    if (!OpenStreams(reader, inputPath, &writer, outputPath))
+        return 1;
+
+    SudokuSolver solver;
+    int cells[CELL_COUNT];
+    unsigned long long solved = 0;
+    unsigned long long failed = 0;
+
+    while (reader.Next(cells))
+    {
+        if (!solver.Solve(cells))
+        {
+            fprintf(stderr, "ligne %llu: aucune solution\n",
+                    (unsigned long long)reader.GetLineNumber());
+            failed++;
+            continue;
+        }
+        writer.Write(cells);
+        solved++;
+    }
+
+    if (!writer.Close())
+    {
+        fprintf(stderr, "Echec de l'ecriture de %s\n", outputPath.c_str());
+        return 1;
+    }
+
+    fprintf(stderr, "%llu grilles resolues, %llu sans solution, %llu lignes invalides\n",
+            solved, failed, (unsigned long long)reader.GetInvalidCount());
+    return (failed == 0 && reader.GetInvalidCount() == 0) ? 0 : 1;
+}
+
+// ============================================================================
+// grade : recopie chaque grille suivie de son niveau ("Invalide" si elle n'a
+// pas de solution unique). La sortie se relit comme une liste de grilles.
+// ============================================================================
+int RunGrade(int argc, char* argv[])
+{
+    std::string inputPath = "-";
+    std::string outputPath = "-";
+    if (!ParseStreamOptions(argc, argv, inputPath, &outputPath))
+        return CLI_USAGE_ERROR;
+
+    PuzzleReader reader;
+    PuzzleWriter writer;
+    if (!OpenStreams(reader, inputPath, &writer, outputPath))
+        return 1;
+
+    int cells[CELL_COUNT];
+    unsigned long long levels[DIFFICULTY_COUNT] = {};
+    unsigned long long rejected = 0;
+
+    while (reader.Next(cells))
+    {
+        int level = PuzzleGenerator::Grade(cells);
+        if (level < 0)
+        {
+            writer.Write(cells, "Invalide");
+            rejected++;
+            continue;
+        }
+        writer.Write(cells, DIFFICULTY_NAMES[level]);
+        levels[level]++;
+    }
+
+    if (!writer.Close())
+    {
+        fprintf(stderr, "Echec de l'ecriture de %s\n", outputPath.c_str());
+        return 1;
+    }
+
+    for (int level = 0; level < DIFFICULTY_COUNT; level++)
+        fprintf(stderr, "%-10s %llu\n", DIFFICULTY_NAMES[level], levels[level]);
+    fprintf(stderr, "%-10s %llu\n", "Invalide", rejected);
+    return 0;
+}
+
+// ============================================================================
+// validate : vérifie que chaque grille a exactement une solution. Les
+// grilles fautives sont listées sur la sortie standard ; code de sortie 1
+// s'il y en a (ou si des lignes sont illisibles).
+// ============================================================================
+int RunValidate(int argc, char* argv[])
+{
+    std::string inputPath = "-";
+    if (!ParseStreamOptions(argc, argv, inputPath, nullptr))
+        return CLI_USAGE_ERROR;
+
+    PuzzleReader reader;
+    if (!OpenStreams(reader, inputPath, nullptr, ""))
+        return 1;
+
+    SudokuSolver solver;
+    int cells[CELL_COUNT];
+    unsigned long long valid = 0;
+    unsigned long long unsolvable = 0;
+    unsigned long long ambiguous = 0;
+
+    while (reader.Next(cells))
+    {
+        int solutions = solver.CountSolutions(cells, 2);
+        if (solutions == 1)
+        {
+            valid++;
+            continue;
+        }
+
+        printf("ligne %llu: %s\n", (unsigned long long)reader.GetLineNumber(),
+               solutions == 0 ? "aucune solution" : "plusieurs solutions");
+        if (solutions == 0)
+            unsolvable++;
+        else
+            ambiguous++;
+    }
+
+    printf("%llu grilles valides, %llu sans solution, %llu a plusieurs solutions, "
+           "%llu lignes illisibles\n",
+           valid, unsolvable, ambiguous, (unsigned long long)reader.GetInvalidCount());
+    return (unsolvable == 0 && ambiguous == 0 && reader.GetInvalidCount() == 0) ? 0 : 1;
+}
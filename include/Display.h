@@ -0,0 +1,32 @@
+// ============================================================================
+// Display.h
+// Constantes d'affichage : fenêtre, position de la grille à l'écran et
+// palette de couleurs (SDL3)
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+#include <SDL3/SDL.h>
+#include "Utils.h"
+
+// Dimensions de la fenêtre
+const int WINDOW_WIDTH = 800;
+const int WINDOW_HEIGHT = 650;
+
+// Grille à l'écran
+const int CELL_SIZE = 50;          // Taille d'une cellule en pixels
+const int GRID_OFFSET_X = 100;     // Décalage horizontal de la grille
+const int GRID_OFFSET_Y = 80;      // Décalage vertical de la grille
+
+// Palette de couleurs du jeu
+const SDL_Color COLOR_WHITE = {255, 255, 255, 255};
+const SDL_Color COLOR_BLACK = {0, 0, 0, 255};
+const SDL_Color COLOR_GRAY = {200, 200, 200, 255};
+const SDL_Color COLOR_LIGHT_BLUE = {200, 220, 255, 255};
+const SDL_Color COLOR_VERY_LIGHT_BLUE = {240, 245, 255, 255};
+const SDL_Color COLOR_BLUE = {70, 130, 220, 255};
+
+#endif // DISPLAY_H
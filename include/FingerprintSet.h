@@ -0,0 +1,74 @@
+// ============================================================================
+// FingerprintSet.h
+// Ensemble d'empreintes 64 bits sans verrou (adressage ouvert), partagé par
+// les threads de génération pour écarter les grilles en double
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef FINGERPRINTSET_H
+#define FINGERPRINTSET_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Compteurs répartis sur plusieurs lignes de cache : les threads qui
+// insèrent des empreintes différentes ne se disputent pas le même compteur
+const int FINGERPRINT_COUNTER_STRIPES = 16;
+
+class FingerprintSet
+{
+private:
+    struct alignas(64) CounterStripe
+    {
+        std::atomic<uint64_t> inserted;
+        std::atomic<uint64_t> duplicates;
+    };
+
+    // Cases de la table (0 = libre), taille puissance de deux
+    std::vector<std::atomic<uint64_t>> mSlots;
+    uint64_t mMask;
+
+    // L'empreinte 0 marque une case libre : elle est suivie à part
+    std::atomic<bool> mHasZero;
+
+    CounterStripe mCounters[FINGERPRINT_COUNTER_STRIPES];
+
+    // Insertions refusées faute de place (table trop petite)
+    std::atomic<uint64_t> mOverflows;
+
+public:
+    // Table dimensionnée pour "expectedCount" empreintes (au plus à moitié
+    // pleine). Elle ne grandit pas.
+    explicit FingerprintSet(uint64_t expectedCount);
+
+    FingerprintSet(const FingerprintSet&) = delete;
+    FingerprintSet& operator=(const FingerprintSet&) = delete;
+
+    // Ajoute l'empreinte si elle est absente. Vrai si elle vient d'être
+    // ajoutée, faux si elle était déjà présente. Utilisable depuis
+    // plusieurs threads en même temps. Si la table est pleine, l'empreinte
+    // est comptée comme nouvelle (voir GetOverflowCount).
+    bool Insert(uint64_t fingerprint);
+
+    // Vrai si l'empreinte est présente
+    bool Contains(uint64_t fingerprint) const;
+
+    // Empreintes distinctes ajoutées
+    uint64_t GetSize() const;
+
+    // Insertions refusées car déjà présentes
+    uint64_t GetDuplicateCount() const;
+
+    // Part des insertions qui étaient des doublons (0 à 1)
+    double GetDuplicateRate() const;
+
+    // Insertions acceptées sans être mémorisées (table pleine)
+    uint64_t GetOverflowCount() const;
+
+    size_t GetCapacity() const;
+};
+
+#endif // FINGERPRINTSET_H
@@ -9,16 +9,64 @@
 #define GAME_H
 
 #include <SDL3/SDL.h>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <utility>
+#include <vector>
 #include "SudokuGrid.h"
 #include "Renderer.h"
 #include "UI.h"
 #include "SplashScreen.h"
+#include "Profiler.h"
+#include "PuzzleDatabase.h"
+#include "PuzzleRing.h"
+#include "SessionStore.h"
+
+// Options de lancement (ligne de commande)
+struct GameOptions
+{
+    bool headless;          // Pilote vidéo hors écran + rendu logiciel
+    int headlessFrames;     // Nombre de frames jouées en mode headless
+    bool showSplash;        // Affiche le splash screen au démarrage
+    bool measureStartup;    // Affiche les jalons du démarrage
+    
+    // Base de grilles pré-générées (ignorée si le fichier n'existe pas).
+    // En headless, seulement si elle est donnée par --puzzle-db=.
+    std::string puzzleDatabase;
+    bool puzzleDatabaseExplicit;
+    
+    // Anneau partagé rempli par "sudoku-cli feed" (vide = pas d'anneau)
+    std::string puzzleRing;
+    
+    // Première grille imposée : grille n° N ou grille d'un jour (-1 =
+    // aucune ; sans l'une ni l'autre, la partie sauvegardée est reprise)
+    int64_t puzzleNumber;
+    int64_t puzzleDay;
+    
+    // Sauvegarde de la partie (vide = dossier de préférences SDL)
+    bool useSession;
+    std::string sessionFile;
+    
+    // Instant du lancement du processus (référence des jalons)
+    std::chrono::steady_clock::time_point launchTime;
+    
+    GameOptions() : headless(false), headlessFrames(600), showSplash(true),
+                    measureStartup(false), puzzleDatabase("puzzles.db"),
+                    puzzleDatabaseExplicit(false), puzzleNumber(-1), puzzleDay(-1),
+                    useSession(true),
+                    launchTime(std::chrono::steady_clock::now())
+    {
+    }
+};
 
 class Game
 {
 private:
     // État du jeu
     bool mIsRunning;
+    GameOptions mOptions;
     
     // Composants SDL
     SDL_Window* mWindow;
@@ -30,12 +78,42 @@ private:
     UI* mUI;
     SplashScreen* mSplashScreen;
     
+    // Base de grilles et source branchée sur SudokuGrid::Initialize
+    PuzzleDatabase* mPuzzleDatabase;
+    DatabasePuzzleSource* mPuzzleSource;
+    
+    // Anneau de grilles partagé, consulté avant la base
+    PuzzleRing* mPuzzleRing;
+    RingPuzzleSource* mRingSource;
+    
+    // Sauvegarde de la partie (nullptr si désactivée)
+    SessionStore* mSessionStore;
+    unsigned long long mLastSessionSave;
+    
+    // Temps de jeu sur la grille courante
+    unsigned long long mElapsedMs;
+    unsigned long long mLastUpdateTicks;
+    
+    // Mesure des temps de frame
+    Profiler mProfiler;
+    
     // État du splash screen
     bool mShowingSplash;
     
     // Sélection de cellule
     int mSelectedRow;
     int mSelectedCol;
+    
+    // Première grille générée sur un thread pendant le démarrage
+    std::future<SudokuGrid> mPendingGrid;
+    bool mGridReady;
+    
+    // Atlas de polices ImGui construit pendant le splash ?
+    bool mUIWarmedUp;
+    
+    // Jalons du démarrage (nom, ms depuis le lancement)
+    std::vector<std::pair<const char*, double>> mStartupMarks;
+    bool mStartupReported;
 
 public:
     // Constructeur et destructeur
@@ -43,7 +121,7 @@ public:
     ~Game();
     
     // Initialise le jeu
-    bool Initialize();
+    bool Initialize(const GameOptions& options = GameOptions());
     
     // Lance la boucle de jeu
     void Run();
@@ -61,12 +139,41 @@ private:
     // Affiche le jeu
     void Render();
     
+    // Boucle sans affichage : entrées scriptées, pas d'attente entre frames
+    void RunHeadless();
+    
+    // Injecte les événements scriptés d'une frame headless
+    void InjectScriptedInput(int frame);
+    
+    // Affiche le rapport de performance du mode headless
+    void ReportHeadless(double elapsedSeconds, int frames);
+    
     // Gère les clics de souris
     void HandleMouseClick(int x, int y);
     
     // Gère les touches du clavier
     void HandleKeyPress(SDL_Keycode key);
     
+    // Nouvelle grille / grille réinitialisée : chronomètre et sélection à
+    // zéro (touches N et R, boutons du menu)
+    void NewGrid();
+    void ResetGrid();
+    
+    // Enregistre un jalon du démarrage
+    void MarkStartup(const char* phase);
+    
+    // Affiche les jalons du démarrage (--measure-startup)
+    void ReportStartup();
+    
+    // Récupère la première grille quand le thread a terminé
+    void PollPendingGrid(bool wait);
+    
+    // Reprend la partie sauvegardée. Faux s'il n'y en a pas.
+    bool RestoreSession(const std::string& path);
+    
+    // Envoie l'état de la partie au thread de sauvegarde
+    void SaveSession();
+    
     // Convertit les coordonnées souris en cellule
     bool GetCellFromMouse(int mouseX, int mouseY, int* row, int* col);
 };
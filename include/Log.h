@@ -0,0 +1,89 @@
+// ============================================================================
+// Log.h
+// Journalisation par niveaux, non bloquante pour la boucle de jeu
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef LOG_H
+#define LOG_H
+
+// Niveaux de journalisation (du plus verbeux au plus grave)
+#define SUDOKU_LOG_LEVEL_DEBUG 0
+#define SUDOKU_LOG_LEVEL_INFO  1
+#define SUDOKU_LOG_LEVEL_WARN  2
+#define SUDOKU_LOG_LEVEL_ERROR 3
+#define SUDOKU_LOG_LEVEL_OFF   4
+
+// Niveau minimal compilé : les appels en dessous disparaissent du binaire
+// (arguments compris). Surchargeable avec -DSUDOKU_LOG_LEVEL=...
+#ifndef SUDOKU_LOG_LEVEL
+    #ifdef NDEBUG
+        #define SUDOKU_LOG_LEVEL SUDOKU_LOG_LEVEL_WARN
+    #else
+        #define SUDOKU_LOG_LEVEL SUDOKU_LOG_LEVEL_DEBUG
+    #endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define SUDOKU_PRINTF_FORMAT(fmtIndex, argIndex) \
+        __attribute__((format(printf, fmtIndex, argIndex)))
+#else
+    #define SUDOKU_PRINTF_FORMAT(fmtIndex, argIndex)
+#endif
+
+enum class LogLevel
+{
+    Debug = SUDOKU_LOG_LEVEL_DEBUG,
+    Info = SUDOKU_LOG_LEVEL_INFO,
+    Warn = SUDOKU_LOG_LEVEL_WARN,
+    Error = SUDOKU_LOG_LEVEL_ERROR
+};
+
+class Logger
+{
+public:
+    // Démarre le thread d'écriture en arrière-plan
+    static void Start();
+
+    // Arrête le thread et vide les messages restants (idempotent)
+    static void Stop();
+
+    // Formate un message et le dépose dans le tampon circulaire.
+    // Ne bloque jamais : si le tampon est plein, le message est perdu.
+    // Sans thread démarré, le message est écrit directement.
+    static void Write(LogLevel level, const char* format, ...) SUDOKU_PRINTF_FORMAT(2, 3);
+
+    // Niveau minimal à l'exécution (en plus du filtre de compilation)
+    static void SetLevel(LogLevel level);
+    
+    // Nombre de messages perdus faute de place dans le tampon
+    static unsigned long long GetDroppedCount();
+};
+
+// Macros de journalisation : supprimées à la compilation sous le niveau minimal
+#if SUDOKU_LOG_LEVEL <= SUDOKU_LOG_LEVEL_DEBUG
+    #define LOG_DEBUG(...) Logger::Write(LogLevel::Debug, __VA_ARGS__)
+#else
+    #define LOG_DEBUG(...) ((void)0)
+#endif
+
+#if SUDOKU_LOG_LEVEL <= SUDOKU_LOG_LEVEL_INFO
+    #define LOG_INFO(...) Logger::Write(LogLevel::Info, __VA_ARGS__)
+#else
+    #define LOG_INFO(...) ((void)0)
+#endif
+
+#if SUDOKU_LOG_LEVEL <= SUDOKU_LOG_LEVEL_WARN
+    #define LOG_WARN(...) Logger::Write(LogLevel::Warn, __VA_ARGS__)
+#else
+    #define LOG_WARN(...) ((void)0)
+#endif
+
+#if SUDOKU_LOG_LEVEL <= SUDOKU_LOG_LEVEL_ERROR
+    #define LOG_ERROR(...) Logger::Write(LogLevel::Error, __VA_ARGS__)
+#else
+    #define LOG_ERROR(...) ((void)0)
+#endif
+
+#endif // LOG_H
@@ -0,0 +1,16 @@
+// ============================================================================
+// Precompiled.h
+// En-tête précompilé (build.py --pch) : headers lourds inclus partout
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef PRECOMPILED_H
+#define PRECOMPILED_H
+
+// Ne contient que des headers externes et stables : toute modification
+// ici reconstruit le PCH et recompile tous les fichiers du projet
+#include <SDL3/SDL.h>
+#include "imgui.h"
+
+#endif // PRECOMPILED_H
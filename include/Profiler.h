@@ -0,0 +1,153 @@
+// ============================================================================
+// Profiler.h
+// Mesure du temps passé dans chaque étape d'une frame
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <chrono>
+#include "Trace.h"
+
+// Active le profileur (0 = supprimé à la compilation, aucun coût)
+#ifndef SUDOKU_PROFILER
+#define SUDOKU_PROFILER 1
+#endif
+
+// Étapes mesurées dans une frame
+enum class ProfileStage
+{
+    Events,         // Game::HandleEvents
+    Update,         // Game::Update
+    Clear,          // Renderer::Clear
+    DrawHighlights, // Renderer::DrawHighlights
+    DrawSelection,  // Renderer::DrawSelection
+    DrawGrid,       // Renderer::DrawGrid
+    DrawNumbers,    // Renderer::DrawNumbers
+    UINewFrame,     // UI::NewFrame
+    UIWindows,      // Fenêtres ImGui (menu, statut, overlay)
+    UIRender,       // UI::Render
+    Present,        // Renderer::Present
+    Count
+};
+
+const int PROFILE_STAGE_COUNT = static_cast<int>(ProfileStage::Count);
+
+class Profiler
+{
+public:
+    // Nombre de frames conservées dans l'historique glissant
+    static const int HISTORY_SIZE = 240;
+
+    typedef std::chrono::steady_clock Clock;
+
+private:
+    // Temps cumulés de la frame en cours (ms)
+    double mCurrent[PROFILE_STAGE_COUNT];
+    Clock::time_point mFrameStart;
+
+    // Historique circulaire (ms)
+    float mStageHistory[PROFILE_STAGE_COUNT][HISTORY_SIZE];
+    float mFrameHistory[HISTORY_SIZE];
+    int mHistoryIndex;  // Prochaine case à écrire
+    int mHistoryCount;  // Nombre de frames valides
+
+    // Cumuls depuis le démarrage (rapports de fin de session)
+    double mTotals[PROFILE_STAGE_COUNT];
+    double mTotalFrameTime;
+    long long mTotalFrames;
+
+    bool mOverlayVisible;
+
+    // Moyenne et 99e centile d'une série de l'historique
+    void ComputeStats(const float* history, float* average, float* p99) const;
+
+public:
+    // Constructeur
+    Profiler();
+
+    // Début de frame : remet les compteurs à zéro
+    void BeginFrame();
+
+    // Fin de frame : enregistre la frame dans l'historique
+    void EndFrame();
+
+    // Ajoute une durée (ms) à une étape de la frame en cours
+    void AddSample(ProfileStage stage, double milliseconds);
+
+    // Statistiques d'une étape sur l'historique (ms)
+    void GetStageStats(ProfileStage stage, float* average, float* p99) const;
+
+    // Statistiques de la frame complète sur l'historique (ms)
+    void GetFrameStats(float* average, float* p99) const;
+
+    // Copie l'historique des frames dans l'ordre chronologique
+    // (out doit contenir HISTORY_SIZE valeurs). Retourne le nombre copié.
+    int GetFrameHistory(float* out) const;
+
+    // Nombre de frames dans l'historique
+    int GetFrameCount() const;
+
+    // Moyennes depuis le démarrage (ms), indépendantes de l'historique
+    double GetStageSessionAverage(ProfileStage stage) const;
+    double GetFrameSessionAverage() const;
+    long long GetSessionFrameCount() const;
+
+    // Nom lisible d'une étape
+    static const char* GetStageName(ProfileStage stage);
+
+    // Affichage de l'overlay
+    void ToggleOverlay();
+    bool IsOverlayVisible() const;
+};
+
+// ============================================================================
+// Chronomètre RAII : ajoute la durée de sa portée à une étape
+// ============================================================================
+class ProfileScope
+{
+private:
+    Profiler& mProfiler;
+    ProfileStage mStage;
+    Profiler::Clock::time_point mStart;
+
+public:
+    ProfileScope(Profiler& profiler, ProfileStage stage)
+        : mProfiler(profiler), mStage(stage), mStart(Profiler::Clock::now())
+    {
+    }
+
+    ~ProfileScope()
+    {
+        Profiler::Clock::time_point end = Profiler::Clock::now();
+        std::chrono::duration<double, std::milli> elapsed = end - mStart;
+        mProfiler.AddSample(mStage, elapsed.count());
+        
+#if SUDOKU_TRACE
+        // Chaque étape devient aussi un intervalle de la trace de session
+        if (TraceRecorder::IsActive())
+            TraceRecorder::AddComplete(Profiler::GetStageName(mStage), "frame", mStart, end);
+#endif
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if SUDOKU_PROFILER
+    #define PROFILE_SCOPE(profiler, stage) \
+        ProfileScope PROFILE_CONCAT(profileScope, __LINE__)((profiler), (stage))
+    #define PROFILE_BEGIN_FRAME(profiler) (profiler).BeginFrame()
+    #define PROFILE_END_FRAME(profiler) (profiler).EndFrame()
+#else
+    #define PROFILE_SCOPE(profiler, stage) ((void)0)
+    #define PROFILE_BEGIN_FRAME(profiler) ((void)0)
+    #define PROFILE_END_FRAME(profiler) ((void)0)
+#endif
+
+#endif // PROFILER_H
@@ -0,0 +1,75 @@
+// ============================================================================
+// PuzzleCanonicalizer.h
+// Forme canonique d'une grille (plus petite forme lexicographique parmi ses
+// grilles équivalentes) et empreinte 64 bits pour la déduplication
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef PUZZLECANONICALIZER_H
+#define PUZZLECANONICALIZER_H
+
+#include <cstdint>
+#include <vector>
+#include "Utils.h"
+
+class SudokuGrid; // Déclaration forward
+
+// ============================================================================
+// Deux grilles sont équivalentes si l'une se déduit de l'autre par une
+// transposition, une permutation des bandes, des piles, des lignes d'une
+// bande ou des colonnes d'une pile, et un renommage des chiffres.
+// La forme canonique est la plus petite grille (lue ligne par ligne,
+// 0 = case vide) de cette classe : deux grilles équivalentes ont la même.
+// ============================================================================
+class PuzzleCanonicalizer
+{
+private:
+    // Transformation partielle : ordre des colonnes fixé, lignes déjà
+    // placées, renommage des chiffres déjà rencontrés
+    struct Candidate
+    {
+        uint8_t transposed;
+        uint8_t lastRow;            // Ligne source de la dernière ligne placée
+        uint16_t columnOrder;       // Index dans la table des 1296 ordres
+        uint16_t placedRows;        // Lignes source déjà placées (bit = ligne)
+        uint8_t labels[10];         // Chiffre source -> chiffre canonique
+        uint8_t nextLabel;
+    };
+
+    // Grille source et sa transposée
+    uint8_t mSource[2][CELL_COUNT];
+
+    // Lignes source non vides (bit = ligne), pour chaque orientation
+    uint16_t mFilledRows[2];
+
+    // Candidats de la ligne courante et de la suivante (réutilisés)
+    std::vector<Candidate> mCandidates;
+    std::vector<Candidate> mNext;
+
+    // Première ligne : candidats dont la ligne a le motif de cases
+    // remplies minimal (le renommage ne dépend que de ce motif). Écrit la
+    // première ligne canonique.
+    void StartCandidates(int* canonical);
+
+    // Fusionne les candidats de même état (mêmes suites possibles)
+    void MergeCandidates();
+
+public:
+    PuzzleCanonicalizer();
+
+    // Forme canonique de 81 cases (0 = vide)
+    void Canonicalize(const int* cells, int* canonical);
+
+    // Forme canonique des cases initiales d'une SudokuGrid
+    void Canonicalize(const SudokuGrid& grid, int* canonical);
+
+    // Empreinte de la forme canonique : identique pour deux grilles
+    // équivalentes
+    uint64_t Fingerprint(const int* cells);
+
+    // Empreinte 64 bits de 81 cases, sans canonisation
+    static uint64_t Hash(const int* cells);
+};
+
+#endif // PUZZLECANONICALIZER_H
@@ -0,0 +1,134 @@
+// ============================================================================
+// PuzzleDatabase.h
+// Base de grilles pré-générées : format binaire compact, lecture par mmap
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef PUZZLEDATABASE_H
+#define PUZZLEDATABASE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <string>
+#include "PuzzleGenerator.h"
+#include "PuzzleSource.h"
+
+// ============================================================================
+// Format du fichier (petit-boutiste) :
+//   en-tête (40 octets), index par difficulté, enregistrements à partir de
+//   dataOffset (aligné sur 64 octets), triés par difficulté.
+// Un enregistrement fait 41 octets : un quartet par case (case i dans le
+// quartet bas de l'octet i/2 si i est pair, haut sinon), 0 = case vide.
+// Les quartets non nuls sont les cases initiales.
+// ============================================================================
+const char PUZZLE_DB_MAGIC[8] = { 'S', 'U', 'D', 'O', 'K', 'U', 'D', 'B' };
+const uint32_t PUZZLE_DB_VERSION = 1;
+const uint32_t PUZZLE_RECORD_SIZE = (CELL_COUNT + 1) / 2;
+
+struct PuzzleDatabaseHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+    uint64_t count;         // Nombre total de grilles
+    uint64_t dataOffset;    // Position du premier enregistrement
+    uint32_t levelCount;    // Entrées de l'index (DIFFICULTY_COUNT)
+    uint32_t reserved;
+};
+
+// Entrée de l'index : grilles d'un niveau de difficulté
+struct PuzzleDatabaseLevel
+{
+    uint64_t first;         // Index du premier enregistrement du niveau
+    uint64_t count;
+};
+
+// Bilan de PuzzleDatabase::Build (affiché par l'appelant : la journalisation
+// INFO est retirée des compilations optimisées)
+struct PuzzleDatabaseBuildStats
+{
+    uint64_t count;                         // Grilles écrites
+    uint64_t levelCounts[DIFFICULTY_COUNT];
+    uint64_t duplicateCount;                // Grilles équivalentes écartées
+    double duplicateRate;                   // Doublons / grilles proposées
+    uint64_t overflowCount;                 // Empreintes non mémorisées (table pleine)
+    double seconds;
+};
+
+// Progression de Build : appelée depuis les threads de génération à chaque
+// dixième de la base
+typedef void (*PuzzleDatabaseProgress)(uint64_t done, uint64_t count);
+
+class PuzzleDatabase
+{
+private:
+    const unsigned char* mData;     // Fichier projeté en mémoire
+    size_t mSize;
+    const PuzzleDatabaseHeader* mHeader;
+    const PuzzleDatabaseLevel* mLevels;
+    const unsigned char* mRecords;
+
+public:
+    // Constructeur et destructeur
+    PuzzleDatabase();
+    ~PuzzleDatabase();
+
+    PuzzleDatabase(const PuzzleDatabase&) = delete;
+    PuzzleDatabase& operator=(const PuzzleDatabase&) = delete;
+
+    // Projette le fichier en mémoire et vérifie l'en-tête
+    bool Open(const std::string& path);
+
+    // Libère la projection
+    void Close();
+
+    bool IsOpen() const;
+
+    // Nombre de grilles (au total ou pour un niveau)
+    uint64_t GetCount() const;
+    uint64_t GetCount(int difficulty) const;
+
+    // Décode la grille "index" (0 = case vide). Accès direct en O(1).
+    // Faux si l'index est hors de la base ou l'enregistrement invalide.
+    bool GetPuzzle(uint64_t index, int* cells) const;
+
+    // Décode la grille "index" d'un niveau de difficulté
+    bool GetPuzzle(int difficulty, uint64_t index, int* cells) const;
+
+    // Conversion grille <-> enregistrement de PUZZLE_RECORD_SIZE octets.
+    // DecodeRecord est faux si un quartet dépasse 9 (fichier corrompu ou
+    // étranger : Open ne vérifie que l'en-tête et l'index).
+    static void EncodeRecord(const int* cells, unsigned char* record);
+    static bool DecodeRecord(const unsigned char* record, int* cells);
+
+    // Génère "count" grilles (sur "threads" threads) et écrit une base.
+    // Les grilles équivalentes par symétrie n'y figurent qu'une fois. Les
+    // enregistrements passent par des fichiers temporaires (un par thread
+    // et par niveau, à côté de "path") : seule la table d'empreintes reste
+    // en mémoire (16 octets par grille).
+    static bool Build(const std::string& path, uint64_t count, unsigned int seed, int threads,
+                      PuzzleDatabaseBuildStats& stats,
+                      PuzzleDatabaseProgress progress = nullptr);
+};
+
+// ============================================================================
+// Source de grilles tirées au hasard dans une base
+// ============================================================================
+class DatabasePuzzleSource : public PuzzleSource
+{
+private:
+    const PuzzleDatabase& mDatabase;
+    int mDifficulty;            // -1 = tous niveaux
+    std::mt19937_64 mRandom;
+    std::mutex mMutex;          // Appelée depuis le thread de démarrage et le jeu
+
+public:
+    DatabasePuzzleSource(const PuzzleDatabase& database, int difficulty);
+
+    bool NextPuzzle(int* cells) override;
+};
+
+#endif // PUZZLEDATABASE_H
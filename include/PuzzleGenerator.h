@@ -0,0 +1,64 @@
+// ============================================================================
+// PuzzleGenerator.h
+// Génération de grilles à solution unique et estimation de leur difficulté
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef PUZZLEGENERATOR_H
+#define PUZZLEGENERATOR_H
+
+#include <cstdint>
+#include "PuzzleRandom.h"
+#include "SudokuSolver.h"
+
+// Niveaux de difficulté (index de la base de grilles)
+const int DIFFICULTY_COUNT = 4;
+extern const char* const DIFFICULTY_NAMES[DIFFICULTY_COUNT];
+
+// Version de l'algorithme de génération. La grille n° N (et la grille du
+// jour) n'est stockée nulle part : elle est recalculée à la demande, et doit
+// rester identique d'une version du jeu à l'autre. Tout changement qui
+// modifie les grilles produites pour une graine (tirages, ordre de retrait,
+// solveur) doit incrémenter cette version et mettre à jour les empreintes
+// de référence de "sudoku-cli golden".
+const uint32_t PUZZLE_ALGORITHM_VERSION = 1;
+
+class PuzzleGenerator
+{
+private:
+    PuzzleRandom mRandom;
+    SudokuSolver mSolver;
+
+    // Grille complète aléatoire
+    void GenerateSolution(int* cells);
+
+public:
+    // Constructeur : même graine = mêmes grilles, sur toutes les plateformes
+    explicit PuzzleGenerator(uint64_t seed);
+
+    // Génère une grille minimale à solution unique (0 = case vide)
+    void Generate(int* cells);
+
+    // Grille n° "number" : première grille d'un générateur dont la graine
+    // est dérivée du numéro et de PUZZLE_ALGORITHM_VERSION
+    static void GenerateNumbered(uint64_t number, int* cells);
+
+    // Grille du jour "day" (voir DayNumber). Ses graines forment un
+    // domaine distinct de celui des grilles numérotées : la grille d'un
+    // jour n'est la grille n° N d'aucun N connu à l'avance.
+    static void GenerateDaily(uint64_t day, int* cells);
+
+    // Jour d'une date : jours écoulés depuis le 1er janvier 1970
+    // (calendrier grégorien). -1 si la date n'existe pas ou la précède.
+    static int64_t DayNumber(int year, int month, int day);
+
+    // Idem pour une date "AAAA-MM-JJ", ou la date locale si "date" est vide
+    static int64_t DayNumber(const char* date);
+
+    // Difficulté estimée (0 à DIFFICULTY_COUNT - 1) d'après l'effort de
+    // recherche du solveur. -1 si la grille n'a pas de solution unique.
+    static int Grade(const int* cells);
+};
+
+#endif // PUZZLEGENERATOR_H
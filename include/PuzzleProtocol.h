@@ -0,0 +1,70 @@
+// ============================================================================
+// PuzzleProtocol.h
+// Protocole binaire du service de grilles (sudoku-cli serve) sur socket
+// Unix : messages préfixés par leur longueur
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef PUZZLEPROTOCOL_H
+#define PUZZLEPROTOCOL_H
+
+#include <cstdint>
+#include "Utils.h"
+
+// ============================================================================
+// Format d'un message (requête ou réponse, ordre des octets de la machine :
+// le socket est local) :
+//   en-tête de 12 octets, puis "length - 8" octets de données.
+// Le client peut envoyer plusieurs requêtes sans attendre les réponses
+// (pipelining) : les réponses d'une connexion peuvent arriver dans le
+// désordre, "requestId" (choisi par le client) les associe aux requêtes.
+//
+// Données selon le code :
+//   Generate : requête 1 octet (niveau 0-3, PUZZLE_ANY_DIFFICULTY = tous),
+//              réponse 81 octets (grille, 0 = case vide)
+//   Solve    : requête 81 octets, réponse 81 octets (solution)
+//   Grade    : requête 81 octets, réponse 1 octet (niveau)
+//   Hint     : requête 81 octets (grille en cours), réponse 2 octets (case
+//              0-80 la plus contrainte parmi les vides, chiffre à y mettre)
+// Une réponse dont le statut n'est pas Ok n'a pas de données. Un message de
+// longueur invalide ferme la connexion.
+// ============================================================================
+enum class PuzzleOpcode : uint8_t
+{
+    Generate = 1,
+    Solve = 2,
+    Grade = 3,
+    Hint = 4
+};
+
+enum class PuzzleStatus : uint8_t
+{
+    Ok = 0,
+    NoSolution = 1,         // Grille contradictoire ou sans solution
+    NotUnique = 2,          // Plusieurs solutions (Grade)
+    BadRequest = 3          // Code inconnu, taille ou chiffres invalides
+};
+
+const uint8_t PUZZLE_ANY_DIFFICULTY = 0xFF;
+
+struct PuzzleMessageHeader
+{
+    uint32_t length;        // Octets qui suivent ce champ (8 + données)
+    uint8_t opcode;         // PuzzleOpcode
+    uint8_t status;         // PuzzleStatus (0 dans une requête)
+    uint16_t reserved;
+    uint32_t requestId;
+};
+
+// Taille maximale des données et d'un message complet
+const uint32_t PUZZLE_MAX_PAYLOAD = CELL_COUNT;
+const uint32_t PUZZLE_MAX_MESSAGE = sizeof(PuzzleMessageHeader) + PUZZLE_MAX_PAYLOAD;
+
+// Valeur de "length" pour des données de "payloadSize" octets
+inline uint32_t PuzzleMessageLength(uint32_t payloadSize)
+{
+    return sizeof(PuzzleMessageHeader) - sizeof(uint32_t) + payloadSize;
+}
+
+#endif // PUZZLEPROTOCOL_H
@@ -0,0 +1,41 @@
+// ============================================================================
+// PuzzleRandom.h
+// Générateur pseudo-aléatoire portable (xoshiro256**, graine SplitMix64) :
+// la même graine donne la même suite sur toutes les plateformes et tous les
+// compilateurs
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef PUZZLERANDOM_H
+#define PUZZLERANDOM_H
+
+#include <cstdint>
+
+// std::mt19937 est portable, mais pas std::shuffle ni les distributions de
+// <random> : leur algorithme dépend de la bibliothèque standard. Les tirages
+// bornés et le mélange sont donc faits ici, sur des entiers 64 bits.
+class PuzzleRandom
+{
+private:
+    uint64_t mState[4];
+
+public:
+    // Constructeur : l'état est dérivé de la graine par SplitMix64
+    explicit PuzzleRandom(uint64_t seed);
+
+    // Mélange d'un entier 64 bits (étape de SplitMix64). Sert aussi à
+    // dériver des graines indépendantes de numéros consécutifs.
+    static uint64_t Mix(uint64_t value);
+
+    // Entier 64 bits suivant
+    uint64_t Next();
+
+    // Entier uniforme dans [0, bound) (bound > 0), sans biais
+    uint32_t Below(uint32_t bound);
+
+    // Mélange de Fisher-Yates
+    void Shuffle(int* values, int count);
+};
+
+#endif // PUZZLERANDOM_H
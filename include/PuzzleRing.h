@@ -0,0 +1,152 @@
+// ============================================================================
+// PuzzleRing.h
+// Anneau de grilles en mémoire partagée : un processus générateur le
+// remplit, les instances du jeu y puisent sans appel système
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef PUZZLERING_H
+#define PUZZLERING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include "PuzzleDatabase.h"
+#include "PuzzleSource.h"
+
+// ============================================================================
+// Segment de mémoire partagée POSIX (shm_open, nom "/..."), ordre des
+// octets de la machine :
+//   en-tête (192 octets), puis "capacity" cases de 64 octets.
+// Une case contient un numéro de séquence et une grille au format d'un
+// enregistrement de la base (41 octets, voir PuzzleDatabase.h).
+//
+// File bornée à un producteur et plusieurs consommateurs : le producteur
+// remplit la case "head" quand sa séquence vaut "head" puis la publie
+// (séquence head + 1) ; un consommateur réserve la position "tail" par
+// compare-and-swap, lit la case puis la rend au producteur (séquence
+// tail + capacity). Les atomiques 64 bits sans verrou fonctionnent entre
+// processus.
+//
+// Un consommateur tué entre la réservation et la lecture ne rend jamais sa
+// case : quand le producteur y revient, l'anneau reste plein pour toujours.
+// Le producteur le détecte (Push refusé alors que GetCount() < capacité) et
+// recrée le segment ; l'ancien est marqué "retired" et les consommateurs
+// (RingPuzzleSource) rouvrent alors l'anneau par son nom.
+// ============================================================================
+const char PUZZLE_RING_MAGIC[8] = { 'S', 'U', 'D', 'O', 'K', 'U', 'R', 'G' };
+const uint32_t PUZZLE_RING_VERSION = 2;
+
+// Nom du segment par défaut
+const char* const PUZZLE_RING_DEFAULT_NAME = "/sudoku-puzzles";
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "Anneau partage : atomiques 64 bits sans verrou requis");
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free,
+              "Anneau partage : atomiques 32 bits sans verrou requis");
+
+struct PuzzleRingHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t slotSize;
+    uint64_t capacity;                  // Puissance de deux
+
+    // 1 quand l'en-tête et les cases sont prêts (écriture "release" en
+    // dernier, lecture "acquire" à l'ouverture)
+    std::atomic<uint32_t> ready;
+
+    // 1 quand le producteur a abandonné ce segment (arrêt ou recréation)
+    std::atomic<uint32_t> retired;
+    uint64_t reserved[4];
+
+    // Positions sur des lignes de cache séparées (écrites par des
+    // processus différents)
+    alignas(64) std::atomic<uint64_t> head;     // Grilles publiées
+    alignas(64) std::atomic<uint64_t> tail;     // Grilles réservées
+};
+
+struct alignas(64) PuzzleRingSlot
+{
+    std::atomic<uint64_t> sequence;
+    unsigned char record[PUZZLE_RECORD_SIZE];
+};
+
+class PuzzleRing
+{
+private:
+    unsigned char* mData;               // Segment projeté
+    size_t mSize;
+    PuzzleRingHeader* mHeader;
+    PuzzleRingSlot* mSlots;
+    uint64_t mMask;
+    std::string mName;
+    bool mOwner;                        // Segment créé ici
+
+public:
+    // Constructeur et destructeur (le destructeur ferme l'anneau)
+    PuzzleRing();
+    ~PuzzleRing();
+
+    PuzzleRing(const PuzzleRing&) = delete;
+    PuzzleRing& operator=(const PuzzleRing&) = delete;
+
+    // Producteur : crée le segment (remplace un anneau existant du même
+    // nom) avec au moins "capacity" cases. Il est supprimé à la fermeture.
+    bool Create(const std::string& name, uint64_t capacity);
+
+    // Consommateur : projette un anneau existant
+    bool Open(const std::string& name);
+
+    // Libère la projection (et, s'il a été créé ici, marque le segment
+    // abandonné puis le supprime)
+    void Close();
+
+    bool IsOpen() const;
+
+    // Segment abandonné par son producteur : à rouvrir par son nom
+    bool IsRetired() const;
+
+    const std::string& GetName() const;
+
+    // Publie une grille. Faux si l'anneau est plein. Un seul producteur à
+    // la fois (les threads d'un même producteur partagent un verrou).
+    bool Push(const int* cells);
+
+    // Prend la plus ancienne grille publiée. Faux si l'anneau est vide (ou
+    // si la grille prise est invalide : elle est écartée).
+    // Sans verrou ni appel système, utilisable par plusieurs consommateurs.
+    bool Pop(int* cells);
+
+    // Grilles disponibles (approximatif pendant les accès concurrents)
+    uint64_t GetCount() const;
+    uint64_t GetCapacity() const;
+};
+
+// ============================================================================
+// Source de grilles puisées dans un anneau, puis dans "fallback" (base de
+// grilles ou nullptr : génération) quand il est vide. L'anneau peut être
+// fermé au départ (jeu lancé avant "sudoku-cli feed") : il est ouvert par
+// son nom dès que le segment existe. Un anneau abandonné par son producteur
+// est rouvert de même (producteur relancé).
+// ============================================================================
+class RingPuzzleSource : public PuzzleSource
+{
+private:
+    PuzzleRing& mRing;
+    PuzzleSource* mFallback;
+    std::string mName;          // Nom du segment, pour le rouvrir
+    std::mutex mMutex;          // Réouverture : appelée depuis le thread de
+                                // démarrage et le jeu
+
+public:
+    RingPuzzleSource(PuzzleRing& ring, const std::string& name, PuzzleSource* fallback);
+
+    bool NextPuzzle(int* cells) override;
+};
+
+#endif // PUZZLERING_H
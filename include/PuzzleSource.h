@@ -0,0 +1,21 @@
+// ============================================================================
+// PuzzleSource.h
+// Fournisseur de grilles pour SudokuGrid::Initialize (base, générateur...)
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef PUZZLESOURCE_H
+#define PUZZLESOURCE_H
+
+class PuzzleSource
+{
+public:
+    virtual ~PuzzleSource() {}
+
+    // Écrit la prochaine grille dans cells (81 cases, 0 = vide).
+    // Faux si aucune grille n'est disponible : la grille est alors générée.
+    virtual bool NextPuzzle(int* cells) = 0;
+};
+
+#endif // PUZZLESOURCE_H
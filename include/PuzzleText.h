@@ -0,0 +1,112 @@
+// ============================================================================
+// PuzzleText.h
+// Lecture / écriture en flux du format texte "une grille de 81 caractères
+// par ligne" ('1'-'9', '0' ou '.' pour une case vide, '#' = commentaire)
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef PUZZLETEXT_H
+#define PUZZLETEXT_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "Utils.h"
+
+class SudokuGrid; // Déclaration forward
+
+// Taille des blocs lus ou écrits en une fois : le fichier n'est jamais
+// chargé en entier
+const size_t PUZZLE_TEXT_CHUNK_SIZE = 1 << 20;
+
+class PuzzleReader
+{
+private:
+    FILE* mFile;
+    bool mOwnsFile;             // Faux pour l'entrée standard
+    std::vector<char> mBuffer;
+    size_t mStart;              // Début de la ligne courante dans mBuffer
+    size_t mEnd;                // Fin des données valides de mBuffer
+    bool mEndOfFile;
+
+    uint64_t mLineNumber;
+    uint64_t mInvalidCount;
+    uint64_t mBytesRead;
+
+    // Recharge le tampon en conservant la ligne incomplète
+    bool Refill();
+
+public:
+    // Constructeur et destructeur
+    PuzzleReader();
+    ~PuzzleReader();
+
+    PuzzleReader(const PuzzleReader&) = delete;
+    PuzzleReader& operator=(const PuzzleReader&) = delete;
+
+    // Ouvre un fichier ("-" = entrée standard)
+    bool Open(const std::string& path);
+    void Close();
+
+    // Lit la prochaine grille valide (lignes vides et commentaires sautés,
+    // texte après la grille et un blanc ignoré, lignes invalides comptées
+    // et sautées). Faux en fin de fichier.
+    bool Next(int* cells);
+    bool Next(SudokuGrid& grid);
+
+    // Numéro de la dernière ligne lue
+    uint64_t GetLineNumber() const;
+
+    // Lignes rejetées (format, caractères ou indices contradictoires)
+    uint64_t GetInvalidCount() const;
+
+    // Octets lus depuis l'ouverture
+    uint64_t GetBytesRead() const;
+
+    // Convertit 81 caractères en chiffres (0 = vide). Faux si un caractère
+    // est invalide. Vectorisé (SSE2) quand c'est possible.
+    static bool ParseDigits(const char* text, int* cells);
+
+    // Vrai si aucun chiffre n'apparaît deux fois dans une ligne, une
+    // colonne ou un bloc
+    static bool HasValidGivens(const int* cells);
+};
+
+class PuzzleWriter
+{
+private:
+    FILE* mFile;
+    bool mOwnsFile;             // Faux pour la sortie standard
+    std::vector<char> mBuffer;
+    size_t mUsed;
+    bool mFailed;
+
+    // Écrit le tampon dans le fichier
+    bool Flush();
+
+public:
+    // Constructeur et destructeur (le destructeur ferme le fichier)
+    PuzzleWriter();
+    ~PuzzleWriter();
+
+    PuzzleWriter(const PuzzleWriter&) = delete;
+    PuzzleWriter& operator=(const PuzzleWriter&) = delete;
+
+    // Ouvre un fichier en écriture ("-" = sortie standard)
+    bool Open(const std::string& path);
+
+    // Vide le tampon et ferme. Faux si une écriture a échoué.
+    bool Close();
+
+    // Ajoute une grille ('.' pour une case vide)
+    bool Write(const int* cells);
+    bool Write(const SudokuGrid& grid);
+
+    // Ajoute une grille suivie d'une courte annotation sur la même ligne
+    // ("<grille> <annotation>") ; PuzzleReader ignore l'annotation
+    bool Write(const int* cells, const char* annotation);
+};
+
+#endif // PUZZLETEXT_H
@@ -9,6 +9,7 @@
 #define RENDERER_H
 
 #include <SDL3/SDL.h>
+#include "Display.h"
 #include "SudokuGrid.h"
 
 class Renderer
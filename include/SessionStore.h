@@ -0,0 +1,101 @@
+// ============================================================================
+// SessionStore.h
+// Sauvegarde de la partie en cours : instantané binaire versionné, écrit
+// de façon atomique sur un thread dédié
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef SESSIONSTORE_H
+#define SESSIONSTORE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "Utils.h"
+
+// ============================================================================
+// Format du fichier (petit-boutiste) : en-tête de 24 octets puis un
+// enregistrement SessionRecord. Une case occupe un octet : chiffre (0 = vide)
+// dans les 4 bits bas, bit 7 pour une case initiale.
+// ============================================================================
+const char SESSION_MAGIC[8] = { 'S', 'U', 'D', 'O', 'K', 'U', 'S', 'V' };
+const uint32_t SESSION_VERSION = 1;
+const uint8_t SESSION_INITIAL_FLAG = 0x80;
+
+struct SessionFileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t checksum;      // FNV-1a de l'enregistrement
+    uint32_t reserved;
+};
+
+struct SessionRecord
+{
+    uint8_t cells[CELL_COUNT];
+    int8_t selectedRow;     // -1 = aucune sélection
+    int8_t selectedCol;
+    uint8_t reserved[5];
+    uint64_t elapsedMs;     // Temps de jeu sur la grille
+};
+
+// État de la partie, tel que le jeu le manipule
+struct SessionSnapshot
+{
+    int cells[CELL_COUNT];
+    bool initial[CELL_COUNT];
+    uint64_t elapsedMs;
+    int selectedRow;
+    int selectedCol;
+};
+
+class SessionStore
+{
+private:
+    std::string mPath;
+
+    // Thread d'écriture : seul le dernier instantané demandé est écrit
+    std::thread mWriterThread;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    SessionSnapshot mPending;
+    bool mHasPending;
+    bool mRemovePending;    // Supprimer le fichier (partie terminée)
+    bool mStopping;
+
+    // Boucle du thread d'écriture
+    void WriterLoop();
+
+public:
+    // Démarre le thread d'écriture pour le fichier "path"
+    explicit SessionStore(const std::string& path);
+
+    // Écrit la dernière demande en attente puis arrête le thread
+    ~SessionStore();
+
+    SessionStore(const SessionStore&) = delete;
+    SessionStore& operator=(const SessionStore&) = delete;
+
+    const std::string& GetPath() const;
+
+    // Demande l'écriture d'un instantané. Ne bloque pas : une demande
+    // encore en attente est remplacée.
+    void Save(const SessionSnapshot& snapshot);
+
+    // Demande la suppression du fichier (plus rien à reprendre)
+    void Discard();
+
+    // Écrit un instantané dans un fichier temporaire puis le renomme :
+    // le fichier est soit l'ancien, soit le nouveau, jamais à moitié écrit
+    static bool Write(const std::string& path, const SessionSnapshot& snapshot);
+
+    // Lit et vérifie un instantané. Faux si le fichier manque, vient d'une
+    // autre version ou est corrompu.
+    static bool Read(const std::string& path, SessionSnapshot& snapshot);
+};
+
+#endif // SESSIONSTORE_H
@@ -25,22 +25,36 @@ private:
     unsigned long long mStartTime;  // Temps de démarrage
     bool mIsFinished;               // Animation terminée ?
     
+    // Textes pré-rendus une seule fois, puis estompés par alpha
+    SDL_Texture* mTitleTexture;     // "JUST MAX IT"
+    SDL_Texture* mSubtitleTexture;  // "Everyday"
+    
     // Calcule l'opacité en fonction du temps
     int CalculateAlpha(unsigned long long currentTime);
     
     // Dessine du texte à l'écran
     void DrawText(const std::string& text, int y, int alpha, bool large = false);
     
+    // Pré-rend un texte dans une texture transparente (nullptr si échec)
+    SDL_Texture* CreateTextTexture(const std::string& text, bool large);
+    
+    // Dessine une texture de texte centrée avec l'opacité demandée
+    void DrawTextTexture(SDL_Texture* texture, int y, int alpha);
+    
     // Dessine le logo complet
     void DrawLogo(int alpha);
 
 public:
-    // Constructeur
+    // Constructeur et destructeur
     SplashScreen(SDL_Renderer* renderer);
+    ~SplashScreen();
     
-    // Démarre l'animation
+    // Démarre l'animation (et pré-rend le logo)
     void Start();
     
+    // Termine immédiatement l'animation (touche ou clic)
+    void Skip();
+    
     // Met à jour l'animation
     void Update();
     
@@ -8,7 +8,9 @@
 #ifndef SUDOKUGRID_H
 #define SUDOKUGRID_H
 
+#include <cstdint>
 #include <vector>
+#include "PuzzleSource.h"
 #include "Utils.h"
 
 class SudokuGrid
@@ -20,19 +22,39 @@ private:
     // Grille des cases initiales (non modifiables)
     std::vector<std::vector<bool>> mInitialGrid;
     
-    // Vérifie si un placement est valide selon les règles du Sudoku
-    bool IsValidPlacement(int row, int col, int num);
+    // Fournisseur de grilles partagé (nullptr = génération aléatoire)
+    static PuzzleSource* sPuzzleSource;
 
 public:
     // Constructeur
     SudokuGrid();
     
-    // Initialise une nouvelle grille
+    // Initialise une nouvelle grille (depuis la source de grilles si
+    // elle en fournit une, sinon par génération aléatoire)
     void Initialize();
     
+    // Source utilisée par Initialize (non possédée, nullptr pour aucune)
+    static void SetPuzzleSource(PuzzleSource* source);
+    
+    // Charge une grille (81 cases, 0 = vide) : les chiffres sont initiaux
+    void LoadPuzzle(const int* cells);
+    
+    // Charge la grille n° "number" (recalculée, identique sur toutes les
+    // plateformes : voir PuzzleGenerator::GenerateNumbered)
+    void LoadNumbered(uint64_t number);
+    
+    // Charge la grille du jour "day" (voir PuzzleGenerator::GenerateDaily)
+    void LoadDaily(uint64_t day);
+    
+    // Restaure une partie : valeurs et cases initiales (81 cases chacune)
+    void Restore(const int* cells, const bool* initial);
+    
     // Génère une grille aléatoire
     void GenerateGrid();
     
+    // Vérifie si un placement est valide selon les règles du Sudoku
+    bool IsValidPlacement(int row, int col, int num) const;
+    
     // Place un chiffre dans une cellule
     bool SetCell(int row, int col, int num);
     
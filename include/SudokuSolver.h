@@ -0,0 +1,57 @@
+// ============================================================================
+// SudokuSolver.h
+// Résolution d'une grille par recherche en profondeur (masques de bits)
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef SUDOKUSOLVER_H
+#define SUDOKUSOLVER_H
+
+#include "Utils.h"
+
+class SudokuSolver
+{
+private:
+    // Chiffres déjà utilisés par ligne, colonne et bloc (bit n-1 = chiffre n)
+    unsigned short mRows[GRID_SIZE];
+    unsigned short mCols[GRID_SIZE];
+    unsigned short mBoxes[GRID_SIZE];
+
+    // Grille de travail (index = ligne * 9 + colonne, 0 = vide)
+    int mCells[CELL_COUNT];
+
+    // Cases vides : les "profondeur" premières sont déjà remplies
+    int mEmpty[CELL_COUNT];
+    int mEmptyCount;
+
+    // Première solution trouvée
+    int mSolution[CELL_COUNT];
+    int mSolutionCount;
+    int mLimit;
+
+    // Nœuds visités par la dernière recherche
+    long long mNodes;
+
+    // Charge une grille ; faux si deux indices se contredisent
+    bool Load(const int* cells);
+
+    // Recherche récursive : choisit la case la plus contrainte
+    void Search(int depth);
+
+public:
+    // Constructeur
+    SudokuSolver();
+
+    // Résout la grille sur place. Faux si elle n'a aucune solution.
+    bool Solve(int* cells);
+
+    // Compte les solutions, en s'arrêtant à "limit" (2 suffit pour
+    // vérifier l'unicité)
+    int CountSolutions(const int* cells, int limit);
+
+    // Nœuds de recherche visités par le dernier appel
+    long long GetNodeCount() const;
+};
+
+#endif // SUDOKUSOLVER_H
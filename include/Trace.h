@@ -0,0 +1,92 @@
+// ============================================================================
+// Trace.h
+// Enregistrement d'une session au format Chrome Trace Event (JSON)
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+// Active l'enregistrement de traces (0 = supprimé à la compilation)
+#ifndef SUDOKU_TRACE
+#define SUDOKU_TRACE 1
+#endif
+
+class TraceRecorder
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+private:
+    static std::atomic<bool> sActive;
+
+public:
+    // Ouvre le fichier et démarre le thread d'écriture
+    static bool Start(const std::string& path);
+
+    // Écrit les événements restants et ferme le fichier (idempotent)
+    static void Stop();
+
+    // Vrai si une session est en cours d'enregistrement
+    static bool IsActive()
+    {
+        return sActive.load(std::memory_order_relaxed);
+    }
+
+    // Ajoute un intervalle terminé. name et category doivent rester
+    // valides jusqu'à Stop() (chaînes littérales).
+    static void AddComplete(const char* name, const char* category,
+                            Clock::time_point start, Clock::time_point end);
+
+    // Ajoute un événement ponctuel
+    static void AddInstant(const char* name, const char* category);
+};
+
+// ============================================================================
+// Intervalle RAII : enregistré seulement si une session est active
+// ============================================================================
+class TraceScope
+{
+private:
+    const char* mName;
+    const char* mCategory;
+    bool mActive;
+    TraceRecorder::Clock::time_point mStart;
+
+public:
+    TraceScope(const char* name, const char* category)
+        : mName(name), mCategory(category), mActive(TraceRecorder::IsActive())
+    {
+        if (mActive)
+            mStart = TraceRecorder::Clock::now();
+    }
+
+    ~TraceScope()
+    {
+        if (mActive)
+            TraceRecorder::AddComplete(mName, mCategory, mStart, TraceRecorder::Clock::now());
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+#if SUDOKU_TRACE
+    #define TRACE_SCOPE(name, category) \
+        TraceScope TRACE_CONCAT(traceScope, __LINE__)((name), (category))
+    #define TRACE_INSTANT(name, category) \
+        do { if (TraceRecorder::IsActive()) TraceRecorder::AddInstant((name), (category)); } while (0)
+#else
+    #define TRACE_SCOPE(name, category) ((void)0)
+    #define TRACE_INSTANT(name, category) ((void)0)
+#endif
+
+#endif // TRACE_H
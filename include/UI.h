@@ -9,9 +9,20 @@
 #define UI_H
 
 #include <SDL3/SDL.h>
+#include <future>
 #include <string>
 
 class SudokuGrid; // Déclaration forward
+class Profiler;   // Déclaration forward
+
+// Action demandée par un bouton du menu principal. Game l'exécute comme les
+// touches N et R (chronomètre et sélection remis à zéro).
+enum class MenuAction
+{
+    None,
+    NewGrid,
+    ResetGrid
+};
 
 class UI
 {
@@ -19,15 +30,25 @@ private:
     bool mShowWinMessage;           // Afficher le message de victoire ?
     std::string mStatusMessage;     // Message temporaire
     unsigned long long mMessageTime; // Temps d'affichage du message
+    
+    // Lecture de imgui.ini en arrière-plan (hors du chemin de démarrage)
+    std::future<std::string> mSettingsLoad;
 
 public:
     // Constructeur et destructeur
     UI();
     ~UI();
     
+    // Lance la lecture de imgui.ini sur un thread (avant Initialize)
+    void StartLoadingSettings();
+    
     // Initialise ImGui
     void Initialize(SDL_Window* window, SDL_Renderer* renderer);
     
+    // Exécute une frame ImGui vide pour construire l'atlas de polices
+    // pendant le splash screen plutôt qu'à la première frame de jeu
+    void WarmUp();
+    
     // Ferme ImGui
     void Shutdown();
     
@@ -37,12 +58,16 @@ public:
     // Affiche le rendu ImGui
     void Render();
     
-    // Dessine le menu principal
-    void DrawMainMenu(SudokuGrid* grid);
+    // Dessine le menu principal et retourne l'action demandée. Boutons de
+    // grille désactivés tant que la première grille n'est pas prête.
+    MenuAction DrawMainMenu(bool gridReady);
     
     // Dessine la barre de statut
     void DrawStatusBar(SudokuGrid* grid);
     
+    // Dessine l'overlay du profileur (temps par étape, graphe des frames)
+    void DrawProfilerOverlay(const Profiler& profiler);
+    
     // Affiche un message temporaire
     void ShowMessage(const std::string& message);
     
@@ -0,0 +1,149 @@
+// ============================================================================
+// FingerprintSet.cpp
+// Implémentation de l'ensemble d'empreintes sans verrou
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "../include/FingerprintSet.h"
+
+// Taille minimale de la table
+static const uint64_t MIN_CAPACITY = 1024;
+
+// ============================================================================
+// Constructeur : au moins deux cases par empreinte attendue
+// ============================================================================
+FingerprintSet::FingerprintSet(uint64_t expectedCount)
+    : mHasZero(false), mOverflows(0)
+{
+    uint64_t capacity = MIN_CAPACITY;
+    while (capacity < expectedCount * 2)
+        capacity *= 2;
+
+    mSlots = std::vector<std::atomic<uint64_t>>(capacity);
+    for (std::atomic<uint64_t>& slot : mSlots)
+        slot.store(0, std::memory_order_relaxed);
+    mMask = capacity - 1;
+
+    for (CounterStripe& stripe : mCounters)
+    {
+        stripe.inserted.store(0, std::memory_order_relaxed);
+        stripe.duplicates.store(0, std::memory_order_relaxed);
+    }
+}
+
+// ============================================================================
+// Ajoute l'empreinte si elle est absente. Les empreintes sont déjà bien
+// mélangées : leurs bits bas donnent directement la case de départ, puis
+// sondage linéaire. Une case ne passe que de 0 à une empreinte (jamais de
+// suppression), un simple compare-and-swap suffit.
+// ============================================================================
+bool FingerprintSet::Insert(uint64_t fingerprint)
+{
+    CounterStripe& counters = mCounters[(fingerprint >> 60) & (FINGERPRINT_COUNTER_STRIPES - 1)];
+
+    bool added;
+    if (fingerprint == 0)
+    {
+        added = !mHasZero.exchange(true, std::memory_order_relaxed);
+    }
+    else
+    {
+        added = false;
+        uint64_t index = fingerprint & mMask;
+        uint64_t probes = 0;
+
+        for (;;)
+        {
+            if (probes++ > mMask)
+            {
+                // Table pleine : impossible de savoir, l'empreinte passe
+                mOverflows.fetch_add(1, std::memory_order_relaxed);
+                added = true;
+                break;
+            }
+
+            std::atomic<uint64_t>& slot = mSlots[index];
+            uint64_t current = slot.load(std::memory_order_relaxed);
+
+            if (current == 0)
+            {
+                // Case libre : elle est à nous, sauf si un autre thread
+                // vient de la prendre (current reçoit alors sa valeur)
+                if (slot.compare_exchange_strong(current, fingerprint, std::memory_order_relaxed))
+                {
+                    added = true;
+                    break;
+                }
+            }
+
+            if (current == fingerprint)
+                break;
+
+            index = (index + 1) & mMask;
+        }
+    }
+
+    if (added)
+        counters.inserted.fetch_add(1, std::memory_order_relaxed);
+    else
+        counters.duplicates.fetch_add(1, std::memory_order_relaxed);
+    return added;
+}
+
+// ============================================================================
+// Vrai si l'empreinte est présente
+// ============================================================================
+bool FingerprintSet::Contains(uint64_t fingerprint) const
+{
+    if (fingerprint == 0)
+        return mHasZero.load(std::memory_order_relaxed);
+
+    uint64_t index = fingerprint & mMask;
+    for (uint64_t probes = 0; probes <= mMask; probes++)
+    {
+        uint64_t current = mSlots[index].load(std::memory_order_relaxed);
+        if (current == fingerprint)
+            return true;
+        if (current == 0)
+            return false;
+        index = (index + 1) & mMask;
+    }
+    return false;
+}
+
+// ============================================================================
+// Compteurs
+// ============================================================================
+uint64_t FingerprintSet::GetSize() const
+{
+    uint64_t total = 0;
+    for (const CounterStripe& stripe : mCounters)
+        total += stripe.inserted.load(std::memory_order_relaxed);
+    return total - GetOverflowCount();
+}
+
+uint64_t FingerprintSet::GetDuplicateCount() const
+{
+    uint64_t total = 0;
+    for (const CounterStripe& stripe : mCounters)
+        total += stripe.duplicates.load(std::memory_order_relaxed);
+    return total;
+}
+
+double FingerprintSet::GetDuplicateRate() const
+{
+    uint64_t duplicates = GetDuplicateCount();
+    uint64_t attempts = GetSize() + GetOverflowCount() + duplicates;
+    return attempts > 0 ? static_cast<double>(duplicates) / attempts : 0.0;
+}
+
+uint64_t FingerprintSet::GetOverflowCount() const
+{
+    return mOverflows.load(std::memory_order_relaxed);
+}
+
+size_t FingerprintSet::GetCapacity() const
+{
+    return mSlots.size();
+}
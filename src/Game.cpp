@@ -8,7 +8,13 @@
 #include "../include/Game.h"
 #include "imgui.h"
 #include "imgui_impl_sdl3.h"
-#include <iostream>
+#include "../include/Log.h"
+#include "../include/Trace.h"
+#include <chrono>
+#include <cstdio>
+
+// Intervalle de la sauvegarde périodique de la partie
+static const unsigned long long SESSION_SAVE_INTERVAL_MS = 30000;
 
 // ============================================================================
 // Constructeur
@@ -19,9 +25,20 @@ Game::Game() : mIsRunning(false),
                mRenderer(nullptr),
                mUI(nullptr),
                mSplashScreen(nullptr),
+               mPuzzleDatabase(nullptr),
+               mPuzzleSource(nullptr),
+               mPuzzleRing(nullptr),
+               mRingSource(nullptr),
+               mSessionStore(nullptr),
+               mLastSessionSave(0),
+               mElapsedMs(0),
+               mLastUpdateTicks(0),
                mShowingSplash(true),
                mSelectedRow(-1),
-               mSelectedCol(-1)
+               mSelectedCol(-1),
+               mGridReady(false),
+               mUIWarmedUp(false),
+               mStartupReported(false)
 {
 }
 
@@ -36,14 +53,104 @@ Game::~Game()
 // ============================================================================
 // Initialise le jeu
 // ============================================================================
-bool Game::Initialize()
+bool Game::Initialize(const GameOptions& options)
 {
+    mOptions = options;
+    
+    // Démarre la journalisation asynchrone
+    Logger::Start();
+    
+    if (mOptions.headless)
+    {
+        // Pas d'écran ni de GPU : pilote hors écran (ou factice) et
+        // rendu logiciel. Les messages de débogage noieraient le rapport.
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen,dummy");
+        Logger::SetLevel(LogLevel::Warn);
+        mOptions.showSplash = false;
+        
+        // Mesures reproductibles : pas de partie reprise ni sauvegardée, et
+        // grilles générées sauf base demandée (un puzzles.db laissé dans le
+        // dossier courant changerait les mesures sans le dire)
+        mOptions.useSession = false;
+        if (!mOptions.puzzleDatabaseExplicit)
+            mOptions.puzzleDatabase.clear();
+    }
+    
+    mShowingSplash = mOptions.showSplash;
+    
+    // Travaux sans dépendance à la fenêtre, lancés en parallèle de SDL :
+    // lecture de imgui.ini et génération de la première grille
+    mUI = new UI();
+    mUI->StartLoadingSettings();
+    
+    // "Nouvelle Grille" puise dans la base si elle existe (projection du
+    // fichier, aucune lecture)
+    mPuzzleDatabase = new PuzzleDatabase();
+    if (!mOptions.puzzleDatabase.empty() && mPuzzleDatabase->Open(mOptions.puzzleDatabase))
+    {
+        mPuzzleSource = new DatabasePuzzleSource(*mPuzzleDatabase, -1);
+        SudokuGrid::SetPuzzleSource(mPuzzleSource);
+    }
+    
+    // Anneau partagé avec un générateur en arrière-plan : prioritaire sur la
+    // base, qui prend le relais quand il est vide. Toujours installé : un
+    // générateur lancé après le jeu est rejoint à la grille suivante.
+    if (!mOptions.puzzleRing.empty())
+    {
+        mPuzzleRing = new PuzzleRing();
+        if (!mPuzzleRing->Open(mOptions.puzzleRing))
+            LOG_WARN("Anneau de grilles pas encore disponible: %s", mOptions.puzzleRing.c_str());
+        mRingSource = new RingPuzzleSource(*mPuzzleRing, mOptions.puzzleRing, mPuzzleSource);
+        SudokuGrid::SetPuzzleSource(mRingSource);
+    }
+    
+    // Reprend la partie sauvegardée (lecture de 120 octets), sinon génère
+    // la première grille en parallèle du démarrage de SDL. Une grille
+    // numérotée demandée remplace la partie sauvegardée.
+    if (mOptions.useSession)
+    {
+        std::string sessionPath = mOptions.sessionFile;
+        if (sessionPath.empty())
+        {
+            char* prefPath = SDL_GetPrefPath("JustMaxIt", "Sudoku");
+            if (prefPath)
+            {
+                sessionPath = std::string(prefPath) + "session.bin";
+                SDL_free(prefPath);
+            }
+        }
+        
+        if (!sessionPath.empty())
+        {
+            if (mOptions.puzzleNumber < 0 && mOptions.puzzleDay < 0)
+                RestoreSession(sessionPath);
+            mSessionStore = new SessionStore(sessionPath);
+        }
+    }
+    
+    if (!mGridReady)
+    {
+        int64_t number = mOptions.puzzleNumber;
+        int64_t day = mOptions.puzzleDay;
+        mPendingGrid = std::async(std::launch::async, [number, day]() {
+            SudokuGrid grid;
+            if (day >= 0)
+                grid.LoadDaily(static_cast<uint64_t>(day));
+            else if (number >= 0)
+                grid.LoadNumbered(static_cast<uint64_t>(number));
+            else
+                grid.Initialize();
+            return grid;
+        });
+    }
+    
     // Initialise SDL
     if (!SDL_Init(SDL_INIT_VIDEO))
     {
-        std::cerr << "Erreur SDL_Init: " << SDL_GetError() << std::endl;
+        LOG_ERROR("Erreur SDL_Init: %s", SDL_GetError());
         return false;
     }
+    MarkStartup("SDL_Init");
     
     // Crée la fenêtre
     mWindow = SDL_CreateWindow(
@@ -55,44 +162,189 @@ bool Game::Initialize()
     
     if (!mWindow)
     {
-        std::cerr << "Erreur fenetre: " << SDL_GetError() << std::endl;
+        LOG_ERROR("Erreur fenetre: %s", SDL_GetError());
         SDL_Quit();
         return false;
     }
+    MarkStartup("Fenetre");
     
     // Crée le renderer
-    mSDLRenderer = SDL_CreateRenderer(mWindow, nullptr);
+    mSDLRenderer = SDL_CreateRenderer(mWindow, mOptions.headless ? "software" : nullptr);
     if (!mSDLRenderer)
     {
-        std::cerr << "Erreur renderer: " << SDL_GetError() << std::endl;
+        LOG_ERROR("Erreur renderer: %s", SDL_GetError());
         SDL_DestroyWindow(mWindow);
         SDL_Quit();
         return false;
     }
+    MarkStartup("Renderer");
+    
+    // Première frame immédiate : fond du splash (noir) ou du jeu (blanc)
+    Uint8 background = mShowingSplash ? 0 : 255;
+    SDL_SetRenderDrawColor(mSDLRenderer, background, background, background, 255);
+    SDL_RenderClear(mSDLRenderer);
+    SDL_RenderPresent(mSDLRenderer);
+    MarkStartup("Premiere frame");
     
     // Initialise les composants
     mRenderer = new Renderer(mSDLRenderer);
-    mUI = new UI();
-    mSplashScreen = new SplashScreen(mSDLRenderer);
-    
     mUI->Initialize(mWindow, mSDLRenderer);
-    mSplashScreen->Start();
-    mGrid.Initialize();
+    MarkStartup("ImGui");
     
-    std::cout << "======================================" << std::endl;
-    std::cout << "  SUDOKU - Just Max It, Everyday" << std::endl;
-    std::cout << "======================================" << std::endl;
-    std::cout << "Initialisation reussie !" << std::endl;
+    if (mShowingSplash)
+    {
+        mSplashScreen = new SplashScreen(mSDLRenderer);
+        mSplashScreen->Start();
+        MarkStartup("Splash pre-rendu");
+    }
+    
+    LOG_INFO("======================================");
+    LOG_INFO("  SUDOKU - Just Max It, Everyday");
+    LOG_INFO("======================================");
+    LOG_INFO("Initialisation reussie !");
     
     mIsRunning = true;
     return true;
 }
 
+// ============================================================================
+// Enregistre un jalon du démarrage
+// ============================================================================
+void Game::MarkStartup(const char* phase)
+{
+    std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - mOptions.launchTime;
+    mStartupMarks.push_back(std::make_pair(phase, elapsed.count()));
+    TRACE_INSTANT(phase, "startup");
+}
+
+// ============================================================================
+// Affiche les jalons du démarrage
+// ============================================================================
+void Game::ReportStartup()
+{
+    mStartupReported = true;
+    
+    if (!mOptions.measureStartup)
+        return;
+    
+    printf("======================================\n");
+    printf("  DEMARRAGE (ms depuis le lancement)\n");
+    printf("======================================\n");
+    
+    for (size_t i = 0; i < mStartupMarks.size(); i++)
+        printf("%-28s %10.3f\n", mStartupMarks[i].first, mStartupMarks[i].second);
+    
+    fflush(stdout);
+}
+
+// ============================================================================
+// Récupère la grille générée au démarrage
+// ============================================================================
+void Game::PollPendingGrid(bool wait)
+{
+    if (mGridReady)
+        return;
+    
+    if (!wait && mPendingGrid.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return;
+    
+    mGrid = mPendingGrid.get();
+    mGridReady = true;
+    MarkStartup("Grille prete");
+}
+
+// ============================================================================
+// Reprend la partie sauvegardée
+// ============================================================================
+bool Game::RestoreSession(const std::string& path)
+{
+    SessionSnapshot snapshot;
+    if (!SessionStore::Read(path, snapshot))
+        return false;
+    
+    mGrid.Restore(snapshot.cells, snapshot.initial);
+    mElapsedMs = snapshot.elapsedMs;
+    mSelectedRow = snapshot.selectedRow;
+    mSelectedCol = snapshot.selectedCol;
+    mGridReady = true;
+    
+    MarkStartup("Session restauree");
+    LOG_INFO("Partie reprise: %s", path.c_str());
+    return true;
+}
+
+// ============================================================================
+// Envoie l'état de la partie au thread de sauvegarde
+// ============================================================================
+void Game::SaveSession()
+{
+    if (!mSessionStore || !mGridReady)
+        return;
+    
+    // Grille terminée : plus rien à reprendre au prochain lancement
+    if (mGrid.CheckWin())
+    {
+        mSessionStore->Discard();
+        return;
+    }
+    
+    SessionSnapshot snapshot;
+    for (int i = 0; i < CELL_COUNT; i++)
+    {
+        snapshot.cells[i] = mGrid.GetCell(i / GRID_SIZE, i % GRID_SIZE);
+        snapshot.initial[i] = mGrid.IsInitialCell(i / GRID_SIZE, i % GRID_SIZE);
+    }
+    snapshot.elapsedMs = mElapsedMs;
+    snapshot.selectedRow = mSelectedRow;
+    snapshot.selectedCol = mSelectedCol;
+    
+    mSessionStore->Save(snapshot);
+}
+
 // ============================================================================
 // Ferme proprement le jeu
 // ============================================================================
 void Game::Shutdown()
 {
+    // Le thread de génération ne doit pas survivre au jeu
+    if (mPendingGrid.valid())
+        mPendingGrid.wait();
+    
+    // Dernière sauvegarde, écrite avant l'arrêt du thread
+    if (mSessionStore)
+    {
+        SaveSession();
+        delete mSessionStore;
+        mSessionStore = nullptr;
+    }
+    
+    if (mRingSource)
+    {
+        SudokuGrid::SetPuzzleSource(nullptr);
+        delete mRingSource;
+        mRingSource = nullptr;
+    }
+    
+    if (mPuzzleRing)
+    {
+        delete mPuzzleRing;
+        mPuzzleRing = nullptr;
+    }
+    
+    if (mPuzzleSource)
+    {
+        SudokuGrid::SetPuzzleSource(nullptr);
+        delete mPuzzleSource;
+        mPuzzleSource = nullptr;
+    }
+    
+    if (mPuzzleDatabase)
+    {
+        delete mPuzzleDatabase;
+        mPuzzleDatabase = nullptr;
+    }
+    
     if (mSplashScreen)
     {
         delete mSplashScreen;
@@ -125,6 +377,9 @@ void Game::Shutdown()
     }
     
     SDL_Quit();
+    
+    // Vide les derniers messages
+    Logger::Stop();
 }
 
 // ============================================================================
@@ -154,56 +409,95 @@ bool Game::GetCellFromMouse(int mouseX, int mouseY, int* row, int* col)
 // ============================================================================
 void Game::HandleMouseClick(int x, int y)
 {
-    std::cout << "[DEBUG] Clic souris a (" << x << "," << y << ")" << std::endl;
+    TRACE_SCOPE("HandleMouseClick", "input");
+    
+    LOG_DEBUG("Clic souris a (%d,%d)", x, y);
+    
+    // Grille pas encore générée
+    if (!mGridReady)
+        return;
     
     int row, col;
     if (GetCellFromMouse(x, y, &row, &col))
     {
         mSelectedRow = row;
         mSelectedCol = col;
-        std::cout << "[DEBUG] Cellule selectionnee: (" << row << "," << col << ")" << std::endl;
+        LOG_DEBUG("Cellule selectionnee: (%d,%d)", row, col);
     }
     else
     {
         mSelectedRow = -1;
         mSelectedCol = -1;
-        std::cout << "[DEBUG] Clic hors grille" << std::endl;
+        LOG_DEBUG("Clic hors grille");
     }
 }
 
+// ============================================================================
+// Nouvelle grille (touche N ou bouton du menu) : la partie repart de zéro
+// ============================================================================
+void Game::NewGrid()
+{
+    LOG_DEBUG("Nouvelle grille demandee");
+    mGrid.Initialize();
+    mSelectedRow = -1;
+    mSelectedCol = -1;
+    mElapsedMs = 0;
+    mUI->ShowMessage("Nouvelle grille");
+}
+
+// ============================================================================
+// Réinitialise la grille (touche R ou bouton du menu)
+// ============================================================================
+void Game::ResetGrid()
+{
+    LOG_DEBUG("Reinitialisation demandee");
+    mGrid.Clear();
+    mGrid.Initialize();
+    mSelectedRow = -1;
+    mSelectedCol = -1;
+    mElapsedMs = 0;
+    mUI->ShowMessage("Reinitialise");
+}
+
 // ============================================================================
 // Gère les touches du clavier
 // ============================================================================
 void Game::HandleKeyPress(SDL_Keycode key)
 {
-    std::cout << "[DEBUG] Touche pressee: " << (int)key << std::endl;
+    TRACE_SCOPE("HandleKeyPress", "input");
+    
+    LOG_DEBUG("Touche pressee: %d", (int)key);
+    
+#if SUDOKU_PROFILER
+    // Overlay du profileur avec F3
+    if (key == SDLK_F3)
+    {
+        mProfiler.ToggleOverlay();
+        return;
+    }
+#endif
+    
+    // Grille pas encore générée
+    if (!mGridReady)
+        return;
     
     // Nouvelle grille avec N
     if (key == SDLK_N)
     {
-        std::cout << "[DEBUG] Nouvelle grille demandee" << std::endl;
-        mGrid.Initialize();
-        mSelectedRow = -1;
-        mSelectedCol = -1;
-        mUI->ShowMessage("Nouvelle grille");
+        NewGrid();
         return;
     }
     // Réinitialiser avec R
     else if (key == SDLK_R)
     {
-        std::cout << "[DEBUG] Reinitialisation demandee" << std::endl;
-        mGrid.Clear();
-        mGrid.Initialize();
-        mSelectedRow = -1;
-        mSelectedCol = -1;
-        mUI->ShowMessage("Reinitialise");
+        ResetGrid();
         return;
     }
     
     // Vérifie qu'une cellule est sélectionnée
     if (mSelectedRow == -1 || mSelectedCol == -1)
     {
-        std::cout << "[DEBUG] Aucune cellule selectionnee" << std::endl;
+        LOG_DEBUG("Aucune cellule selectionnee");
         return;
     }
     
@@ -213,7 +507,7 @@ void Game::HandleKeyPress(SDL_Keycode key)
     if (key >= SDLK_1 && key <= SDLK_9)
     {
         num = key - SDLK_0;
-        std::cout << "[DEBUG] Chiffre detecte (touches principales): " << num << std::endl;
+        LOG_DEBUG("Chiffre detecte (touches principales): %d", num);
     }
     // PAVÉ NUMÉRIQUE - Correction du calcul
     else if (key >= SDLK_KP_1 && key <= SDLK_KP_9)
@@ -221,29 +515,29 @@ void Game::HandleKeyPress(SDL_Keycode key)
         // Les touches du pavé numérique ont des codes spéciaux
         // SDLK_KP_1 = 1073741913, SDLK_KP_9 = 1073741921
         num = (key - SDLK_KP_1) + 1;
-        std::cout << "[DEBUG] Chiffre detecte (pave numerique): " << num << std::endl;
+        LOG_DEBUG("Chiffre detecte (pave numerique): %d", num);
     }
     // Effacer
     else if (key == SDLK_BACKSPACE || key == SDLK_DELETE || 
              key == SDLK_0 || key == SDLK_KP_0)
     {
         num = 0;
-        std::cout << "[DEBUG] Effacement demande" << std::endl;
+        LOG_DEBUG("Effacement demande");
     }
     else
     {
-        std::cout << "[DEBUG] Touche non reconnue pour placement (code: " << (int)key << ")" << std::endl;
+        LOG_DEBUG("Touche non reconnue pour placement (code: %d)", (int)key);
         return;
     }
     
-    std::cout << "[DEBUG] Tentative placement: " << num << " a (" << mSelectedRow << "," << mSelectedCol << ")" << std::endl;
+    LOG_DEBUG("Tentative placement: %d a (%d,%d)", num, mSelectedRow, mSelectedCol);
     
     // Tente le placement
     bool success = mGrid.SetCell(mSelectedRow, mSelectedCol, num);
     
     if (success)
     {
-        std::cout << "[DEBUG] Placement reussi !" << std::endl;
+        LOG_DEBUG("Placement reussi !");
         if (num == 0)
             mUI->ShowMessage("Efface");
         else
@@ -251,12 +545,12 @@ void Game::HandleKeyPress(SDL_Keycode key)
         
         if (mGrid.CheckWin())
         {
-            std::cout << "[DEBUG] VICTOIRE DETECTEE !" << std::endl;
+            LOG_INFO("VICTOIRE DETECTEE !");
         }
     }
     else
     {
-        std::cout << "[DEBUG] Placement echoue" << std::endl;
+        LOG_DEBUG("Placement echoue");
         if (mGrid.IsInitialCell(mSelectedRow, mSelectedCol))
             mUI->ShowMessage("Case fixe");
         else
@@ -276,15 +570,20 @@ void Game::HandleEvents()
         
         if (event.type == SDL_EVENT_QUIT)
         {
-            std::cout << "[DEBUG] Fermeture demandee" << std::endl;
+            LOG_DEBUG("Fermeture demandee");
             mIsRunning = false;
         }
         else if (event.type == SDL_EVENT_MOUSE_BUTTON_DOWN)
         {
-            if (event.button.button == SDL_BUTTON_LEFT)
+            if (mShowingSplash)
             {
-                std::cout << "[DEBUG] Clic gauche detecte" << std::endl;
-                std::cout << "[DEBUG] Splash: " << mShowingSplash << ", ImGui capture: " << mUI->WantsMouseCapture() << std::endl;
+                // N'importe quel clic passe le splash screen
+                mSplashScreen->Skip();
+            }
+            else if (event.button.button == SDL_BUTTON_LEFT)
+            {
+                LOG_DEBUG("Clic gauche detecte");
+                LOG_DEBUG("Splash: %d, ImGui capture: %d", mShowingSplash, mUI->WantsMouseCapture());
                 
                 if (!mShowingSplash && !mUI->WantsMouseCapture())
                 {
@@ -295,20 +594,25 @@ void Game::HandleEvents()
                 }
                 else
                 {
-                    std::cout << "[DEBUG] Clic ignore (splash ou ImGui)" << std::endl;
+                    LOG_DEBUG("Clic ignore (splash ou ImGui)");
                 }
             }
         }
+        else if (event.type == SDL_EVENT_KEY_DOWN && mShowingSplash)
+        {
+            // N'importe quelle touche passe le splash screen
+            mSplashScreen->Skip();
+        }
         else if (event.type == SDL_EVENT_KEY_DOWN)
         {
-            std::cout << "[DEBUG] Touche detectee" << std::endl;
-            std::cout << "[DEBUG] Splash: " << mShowingSplash << ", ImGui capture: " << mUI->WantsKeyboardCapture() << std::endl;
+            LOG_DEBUG("Touche detectee");
+            LOG_DEBUG("Splash: %d, ImGui capture: %d", mShowingSplash, mUI->WantsKeyboardCapture());
             
             if (!mShowingSplash && !mUI->WantsKeyboardCapture())
             {
                 if (event.key.key == SDLK_ESCAPE)
                 {
-                    std::cout << "[DEBUG] Echap -> Quitter" << std::endl;
+                    LOG_DEBUG("Echap -> Quitter");
                     mIsRunning = false;
                 }
                 else
@@ -318,7 +622,7 @@ void Game::HandleEvents()
             }
             else
             {
-                std::cout << "[DEBUG] Touche ignoree (splash ou ImGui)" << std::endl;
+                LOG_DEBUG("Touche ignoree (splash ou ImGui)");
             }
         }
     }
@@ -329,6 +633,19 @@ void Game::HandleEvents()
 // ============================================================================
 void Game::Update()
 {
+    unsigned long long now = SDL_GetTicks();
+    
+    // Temps de jeu : compté dès que la grille est prête, arrêté à la victoire
+    if (mGridReady && mLastUpdateTicks != 0 && !mGrid.CheckWin())
+        mElapsedMs += now - mLastUpdateTicks;
+    mLastUpdateTicks = now;
+    
+    // Sauvegarde périodique (l'écriture se fait sur un autre thread)
+    if (mSessionStore && now - mLastSessionSave >= SESSION_SAVE_INTERVAL_MS)
+    {
+        SaveSession();
+        mLastSessionSave = now;
+    }
 }
 
 // ============================================================================
@@ -336,18 +653,53 @@ void Game::Update()
 // ============================================================================
 void Game::Render()
 {
-    mRenderer->Clear();
-    mRenderer->DrawHighlights(mSelectedRow, mSelectedCol);
-    mRenderer->DrawSelection(mSelectedRow, mSelectedCol);
-    mRenderer->DrawGrid();
-    mRenderer->DrawNumbers(&mGrid);
-    
-    mUI->NewFrame();
-    mUI->DrawMainMenu(&mGrid);
-    mUI->DrawStatusBar(&mGrid);
-    mUI->Render();
-    
-    mRenderer->Present();
+    {
+        PROFILE_SCOPE(mProfiler, ProfileStage::Clear);
+        mRenderer->Clear();
+    }
+    {
+        PROFILE_SCOPE(mProfiler, ProfileStage::DrawHighlights);
+        mRenderer->DrawHighlights(mSelectedRow, mSelectedCol);
+    }
+    {
+        PROFILE_SCOPE(mProfiler, ProfileStage::DrawSelection);
+        mRenderer->DrawSelection(mSelectedRow, mSelectedCol);
+    }
+    {
+        PROFILE_SCOPE(mProfiler, ProfileStage::DrawGrid);
+        mRenderer->DrawGrid();
+    }
+    {
+        PROFILE_SCOPE(mProfiler, ProfileStage::DrawNumbers);
+        mRenderer->DrawNumbers(&mGrid);
+    }
+    
+    {
+        PROFILE_SCOPE(mProfiler, ProfileStage::UINewFrame);
+        mUI->NewFrame();
+    }
+    {
+        PROFILE_SCOPE(mProfiler, ProfileStage::UIWindows);
+        MenuAction action = mUI->DrawMainMenu(mGridReady);
+        if (action == MenuAction::NewGrid)
+            NewGrid();
+        else if (action == MenuAction::ResetGrid)
+            ResetGrid();
+        mUI->DrawStatusBar(&mGrid);
+#if SUDOKU_PROFILER
+        if (mProfiler.IsOverlayVisible())
+            mUI->DrawProfilerOverlay(mProfiler);
+#endif
+    }
+    {
+        PROFILE_SCOPE(mProfiler, ProfileStage::UIRender);
+        mUI->Render();
+    }
+    
+    {
+        PROFILE_SCOPE(mProfiler, ProfileStage::Present);
+        mRenderer->Present();
+    }
 }
 
 // ============================================================================
@@ -355,32 +707,227 @@ void Game::Render()
 // ============================================================================
 void Game::Run()
 {
-    std::cout << "[DEBUG] Demarrage boucle de jeu" << std::endl;
+    if (mOptions.headless)
+    {
+        RunHeadless();
+        return;
+    }
+    
+    LOG_DEBUG("Demarrage boucle de jeu");
     
     while (mIsRunning)
     {
-        HandleEvents();
+        PROFILE_BEGIN_FRAME(mProfiler);
+        
+        {
+            PROFILE_SCOPE(mProfiler, ProfileStage::Events);
+            HandleEvents();
+        }
+        
+        PollPendingGrid(false);
         
         if (mShowingSplash)
         {
+            TRACE_SCOPE("SplashScreen", "splash");
             mSplashScreen->Update();
-            mSplashScreen->Render();
-            SDL_RenderPresent(mSDLRenderer);
             
             if (mSplashScreen->IsFinished())
             {
-                std::cout << "[DEBUG] Splash screen termine - Passage au jeu" << std::endl;
+                // Passe au jeu dès cette frame (pas de dernière image du splash)
+                LOG_DEBUG("Splash screen termine - Passage au jeu");
                 mShowingSplash = false;
             }
+            else
+            {
+                mSplashScreen->Render();
+                
+                // Profite du splash pour préparer ImGui (sans rien afficher)
+                if (!mUIWarmedUp)
+                {
+                    mUI->WarmUp();
+                    mUIWarmedUp = true;
+                    MarkStartup("ImGui polices");
+                }
+                
+                SDL_RenderPresent(mSDLRenderer);
+            }
         }
-        else
+        
+        if (!mShowingSplash)
         {
-            Update();
+            {
+                PROFILE_SCOPE(mProfiler, ProfileStage::Update);
+                Update();
+            }
             Render();
+            
+            // Seules les frames de jeu entrent dans l'historique
+            PROFILE_END_FRAME(mProfiler);
+            
+            if (!mStartupReported)
+            {
+                MarkStartup("Premiere frame interactive");
+                ReportStartup();
+            }
         }
         
         SDL_Delay(16);
     }
     
-    std::cout << "[DEBUG] Fin boucle de jeu" << std::endl;
-}
\ No newline at end of file
+    LOG_DEBUG("Fin boucle de jeu");
+}
+
+// ============================================================================
+// Injecte les entrées scriptées d'une frame headless.
+// Script déterministe : sélection d'une case toutes les 4 frames, chiffre
+// ou effacement entre deux, nouvelle grille toutes les 240 frames.
+// ============================================================================
+void Game::InjectScriptedInput(int frame)
+{
+    SDL_WindowID windowID = SDL_GetWindowID(mWindow);
+    SDL_Event event;
+    
+    // Appui puis relâchement d'une touche
+    auto pushKey = [&event, windowID](SDL_Keycode key) {
+        for (int down = 1; down >= 0; down--)
+        {
+            SDL_zero(event);
+            event.type = down ? SDL_EVENT_KEY_DOWN : SDL_EVENT_KEY_UP;
+            event.key.windowID = windowID;
+            event.key.key = key;
+            event.key.down = (down != 0);
+            SDL_PushEvent(&event);
+        }
+    };
+    
+    if (frame % 240 == 239)
+    {
+        pushKey(SDLK_N);
+        return;
+    }
+    
+    int step = frame % 4;
+    int cell = (frame / 4) % (GRID_SIZE * GRID_SIZE);
+    
+    if (step == 0)
+    {
+        // Clic au centre de la case (déplacement puis appui/relâchement)
+        float x = (float)(GRID_OFFSET_X + (cell % GRID_SIZE) * CELL_SIZE + CELL_SIZE / 2);
+        float y = (float)(GRID_OFFSET_Y + (cell / GRID_SIZE) * CELL_SIZE + CELL_SIZE / 2);
+        
+        SDL_zero(event);
+        event.type = SDL_EVENT_MOUSE_MOTION;
+        event.motion.windowID = windowID;
+        event.motion.x = x;
+        event.motion.y = y;
+        SDL_PushEvent(&event);
+        
+        for (int down = 1; down >= 0; down--)
+        {
+            SDL_zero(event);
+            event.type = down ? SDL_EVENT_MOUSE_BUTTON_DOWN : SDL_EVENT_MOUSE_BUTTON_UP;
+            event.button.windowID = windowID;
+            event.button.button = SDL_BUTTON_LEFT;
+            event.button.down = (down != 0);
+            event.button.clicks = 1;
+            event.button.x = x;
+            event.button.y = y;
+            SDL_PushEvent(&event);
+        }
+    }
+    else if (step == 1)
+    {
+        // Chiffre reproductible
+        pushKey(SDLK_1 + (SDL_Keycode)((frame / 4 * 7) % 9));
+    }
+    else if (step == 2 && (frame / 4) % 3 == 0)
+    {
+        // Efface une case sur trois
+        pushKey(SDLK_BACKSPACE);
+    }
+}
+
+// ============================================================================
+// Boucle headless : mesure du débit de frames
+// ============================================================================
+void Game::RunHeadless()
+{
+    LOG_INFO("Mode headless: %d frames (video: %s, rendu: %s)",
+             mOptions.headlessFrames, SDL_GetCurrentVideoDriver(),
+             SDL_GetRendererName(mSDLRenderer));
+    
+    // Mesures reproductibles : la grille doit exister avant la première frame
+    PollPendingGrid(true);
+    
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    int frame = 0;
+    
+    for (; frame < mOptions.headlessFrames && mIsRunning; frame++)
+    {
+        PROFILE_BEGIN_FRAME(mProfiler);
+        
+        InjectScriptedInput(frame);
+        
+        {
+            PROFILE_SCOPE(mProfiler, ProfileStage::Events);
+            HandleEvents();
+        }
+        {
+            PROFILE_SCOPE(mProfiler, ProfileStage::Update);
+            Update();
+        }
+        Render();
+        
+        PROFILE_END_FRAME(mProfiler);
+        
+        if (!mStartupReported)
+        {
+            MarkStartup("Premiere frame interactive");
+            ReportStartup();
+        }
+    }
+    
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    ReportHeadless(elapsed.count(), frame);
+}
+
+// ============================================================================
+// Rapport de fin de session headless
+// ============================================================================
+void Game::ReportHeadless(double elapsedSeconds, int frames)
+{
+    double fps = (elapsedSeconds > 0.0) ? frames / elapsedSeconds : 0.0;
+    
+    printf("======================================\n");
+    printf("  RAPPORT HEADLESS\n");
+    printf("======================================\n");
+    printf("Frames         : %d\n", frames);
+    printf("Duree          : %.3f s\n", elapsedSeconds);
+    printf("Frames/seconde : %.1f\n", fps);
+    
+#if SUDOKU_PROFILER
+    // Moyenne et p99 sur la même fenêtre (historique glissant) ; la moyenne
+    // de session, sur toutes les frames, dans sa propre colonne
+    float average, p99;
+    int recent = mProfiler.GetFrameCount();
+    long long total = mProfiler.GetSessionFrameCount();
+    mProfiler.GetFrameStats(&average, &p99);
+    printf("Frame          : moy %.4f ms, p99 %.4f ms (%d dernieres frames)\n",
+           average, p99, recent);
+    printf("                 moy %.4f ms (session, %lld frames)\n",
+           mProfiler.GetFrameSessionAverage(), total);
+    printf("\n%-14s %14s %14s %14s\n", "", "Dernieres", "Dernieres", "Session");
+    printf("%-14s %14s %14s %14s\n", "Etape", "Moy (ms)", "p99 (ms)", "Moy (ms)");
+    
+    for (int i = 0; i < PROFILE_STAGE_COUNT; i++)
+    {
+        ProfileStage stage = static_cast<ProfileStage>(i);
+        mProfiler.GetStageStats(stage, &average, &p99);
+        printf("%-14s %14.4f %14.4f %14.4f\n", Profiler::GetStageName(stage),
+               average, p99, mProfiler.GetStageSessionAverage(stage));
+    }
+    printf("(Dernieres : %d dernieres frames ; Session : %lld frames)\n", recent, total);
+#endif
+    
+    fflush(stdout);
+}
@@ -0,0 +1,219 @@
+// ============================================================================
+// Log.cpp
+// Implémentation de la journalisation asynchrone
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "../include/Log.h"
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <thread>
+
+// ============================================================================
+// Tampon circulaire borné multi-producteurs / consommateur unique.
+// Chaque case porte un numéro de séquence qui indique à qui elle appartient
+// (producteur ou consommateur) : aucun verrou, aucun appel système côté jeu.
+// ============================================================================
+static const size_t LOG_CAPACITY = 1024;           // Puissance de 2
+static const size_t LOG_MASK = LOG_CAPACITY - 1;
+static const size_t LOG_MESSAGE_SIZE = 240;         // Taille max d'un message
+
+struct LogSlot
+{
+    std::atomic<size_t> sequence;
+    LogLevel level;
+    char text[LOG_MESSAGE_SIZE];
+};
+
+static LogSlot sSlots[LOG_CAPACITY];
+static std::atomic<size_t> sEnqueuePos(0);
+static size_t sDequeuePos = 0;                      // Lu par le seul consommateur
+static std::atomic<unsigned long long> sDropped(0);
+static std::atomic<bool> sRunning(false);
+static std::atomic<int> sMinLevel(SUDOKU_LOG_LEVEL_DEBUG);
+static std::thread sWriterThread;
+
+// ============================================================================
+// Préfixe affiché pour chaque niveau
+// ============================================================================
+static const char* LevelPrefix(LogLevel level)
+{
+    switch (level)
+    {
+        case LogLevel::Debug: return "[DEBUG] ";
+        case LogLevel::Info:  return "";
+        case LogLevel::Warn:  return "[ATTENTION] ";
+        case LogLevel::Error: return "[ERREUR] ";
+    }
+    return "";
+}
+
+// ============================================================================
+// Écrit un message formaté sur la sortie adaptée à son niveau
+// ============================================================================
+static void Emit(LogLevel level, const char* text)
+{
+    FILE* stream = (level == LogLevel::Error) ? stderr : stdout;
+    fputs(LevelPrefix(level), stream);
+    fputs(text, stream);
+    fputc('\n', stream);
+}
+
+// ============================================================================
+// Vide le tampon (consommateur). Retourne le nombre de messages écrits.
+// ============================================================================
+static size_t Drain()
+{
+    size_t count = 0;
+
+    for (;;)
+    {
+        LogSlot& slot = sSlots[sDequeuePos & LOG_MASK];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+
+        // La case n'a pas encore été publiée par un producteur
+        if (sequence != sDequeuePos + 1)
+            break;
+
+        Emit(slot.level, slot.text);
+
+        // Rend la case aux producteurs pour le tour suivant
+        slot.sequence.store(sDequeuePos + LOG_CAPACITY, std::memory_order_release);
+        sDequeuePos++;
+        count++;
+    }
+
+    if (count > 0)
+    {
+        fflush(stdout);
+        fflush(stderr);
+    }
+
+    return count;
+}
+
+// ============================================================================
+// Boucle du thread d'écriture
+// ============================================================================
+static void WriterLoop()
+{
+    while (sRunning.load(std::memory_order_acquire))
+    {
+        // Les producteurs ne réveillent jamais ce thread (pas d'appel
+        // système côté jeu) : il sonde le tampon à intervalle court.
+        if (Drain() == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+}
+
+// ============================================================================
+// Démarre le thread d'écriture
+// ============================================================================
+void Logger::Start()
+{
+    if (sRunning.exchange(true))
+        return;
+
+    for (size_t i = 0; i < LOG_CAPACITY; i++)
+        sSlots[i].sequence.store(i, std::memory_order_relaxed);
+    sEnqueuePos.store(0, std::memory_order_relaxed);
+    sDequeuePos = 0;
+
+    sWriterThread = std::thread(WriterLoop);
+}
+
+// ============================================================================
+// Arrête le thread et vide les messages restants
+// ============================================================================
+void Logger::Stop()
+{
+    if (!sRunning.exchange(false))
+        return;
+
+    if (sWriterThread.joinable())
+        sWriterThread.join();
+
+    Drain();
+
+    unsigned long long dropped = sDropped.exchange(0);
+    if (dropped > 0)
+    {
+        fprintf(stderr, "[ATTENTION] %llu message(s) de log perdu(s)\n", dropped);
+    }
+}
+
+// ============================================================================
+// Dépose un message dans le tampon (producteur)
+// ============================================================================
+void Logger::Write(LogLevel level, const char* format, ...)
+{
+    if (static_cast<int>(level) < sMinLevel.load(std::memory_order_relaxed))
+        return;
+    
+    va_list args;
+    va_start(args, format);
+
+    // Sans thread d'écriture : écriture directe (outils, tout début du jeu)
+    if (!sRunning.load(std::memory_order_acquire))
+    {
+        char text[LOG_MESSAGE_SIZE];
+        vsnprintf(text, sizeof(text), format, args);
+        va_end(args);
+        Emit(level, text);
+        return;
+    }
+
+    // Réserve une case libre
+    size_t pos = sEnqueuePos.load(std::memory_order_relaxed);
+    LogSlot* slot = nullptr;
+
+    for (;;)
+    {
+        slot = &sSlots[pos & LOG_MASK];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        long long diff = (long long)sequence - (long long)pos;
+
+        if (diff == 0)
+        {
+            if (sEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+        {
+            // Tampon plein : on perd le message plutôt que de bloquer
+            sDropped.fetch_add(1, std::memory_order_relaxed);
+            va_end(args);
+            return;
+        }
+        else
+        {
+            pos = sEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->level = level;
+    vsnprintf(slot->text, sizeof(slot->text), format, args);
+    va_end(args);
+
+    // Publie la case au consommateur
+    slot->sequence.store(pos + 1, std::memory_order_release);
+}
+
+// ============================================================================
+// Niveau minimal à l'exécution
+// ============================================================================
+void Logger::SetLevel(LogLevel level)
+{
+    sMinLevel.store(static_cast<int>(level), std::memory_order_relaxed);
+}
+
+// ============================================================================
+// Nombre de messages perdus
+// ============================================================================
+unsigned long long Logger::GetDroppedCount()
+{
+    return sDropped.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,201 @@
+// ============================================================================
+// Profiler.cpp
+// Implémentation du profileur de frames
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "../include/Profiler.h"
+#include <algorithm>
+
+// ============================================================================
+// Constructeur
+// ============================================================================
+Profiler::Profiler() : mHistoryIndex(0), mHistoryCount(0),
+                       mTotalFrameTime(0.0), mTotalFrames(0),
+                       mOverlayVisible(false)
+{
+    for (int i = 0; i < PROFILE_STAGE_COUNT; i++)
+    {
+        mCurrent[i] = 0.0;
+        mTotals[i] = 0.0;
+        for (int j = 0; j < HISTORY_SIZE; j++)
+            mStageHistory[i][j] = 0.0f;
+    }
+
+    for (int j = 0; j < HISTORY_SIZE; j++)
+        mFrameHistory[j] = 0.0f;
+
+    mFrameStart = Clock::now();
+}
+
+// ============================================================================
+// Début de frame
+// ============================================================================
+void Profiler::BeginFrame()
+{
+    for (int i = 0; i < PROFILE_STAGE_COUNT; i++)
+        mCurrent[i] = 0.0;
+
+    mFrameStart = Clock::now();
+}
+
+// ============================================================================
+// Fin de frame : copie les mesures dans l'historique
+// ============================================================================
+void Profiler::EndFrame()
+{
+    Clock::time_point frameEnd = Clock::now();
+    std::chrono::duration<double, std::milli> frameTime = frameEnd - mFrameStart;
+    
+#if SUDOKU_TRACE
+    if (TraceRecorder::IsActive())
+        TraceRecorder::AddComplete("Frame", "frame", mFrameStart, frameEnd);
+#endif
+
+    for (int i = 0; i < PROFILE_STAGE_COUNT; i++)
+    {
+        mStageHistory[i][mHistoryIndex] = (float)mCurrent[i];
+        mTotals[i] += mCurrent[i];
+    }
+
+    mFrameHistory[mHistoryIndex] = (float)frameTime.count();
+    mTotalFrameTime += frameTime.count();
+    mTotalFrames++;
+
+    mHistoryIndex = (mHistoryIndex + 1) % HISTORY_SIZE;
+    if (mHistoryCount < HISTORY_SIZE)
+        mHistoryCount++;
+}
+
+// ============================================================================
+// Ajoute une durée à une étape
+// ============================================================================
+void Profiler::AddSample(ProfileStage stage, double milliseconds)
+{
+    mCurrent[static_cast<int>(stage)] += milliseconds;
+}
+
+// ============================================================================
+// Moyenne et 99e centile d'une série
+// ============================================================================
+void Profiler::ComputeStats(const float* history, float* average, float* p99) const
+{
+    *average = 0.0f;
+    *p99 = 0.0f;
+
+    if (mHistoryCount == 0)
+        return;
+
+    // Cases valides : les mHistoryCount premières avant rebouclage,
+    // toutes ensuite (l'ordre importe peu pour ces statistiques)
+    float sorted[HISTORY_SIZE];
+    double sum = 0.0;
+    for (int i = 0; i < mHistoryCount; i++)
+    {
+        sorted[i] = history[i];
+        sum += history[i];
+    }
+
+    *average = (float)(sum / mHistoryCount);
+
+    int rank = (mHistoryCount * 99 + 99) / 100 - 1; // Centile "nearest rank"
+    std::nth_element(sorted, sorted + rank, sorted + mHistoryCount);
+    *p99 = sorted[rank];
+}
+
+// ============================================================================
+// Statistiques d'une étape
+// ============================================================================
+void Profiler::GetStageStats(ProfileStage stage, float* average, float* p99) const
+{
+    ComputeStats(mStageHistory[static_cast<int>(stage)], average, p99);
+}
+
+// ============================================================================
+// Statistiques de la frame complète
+// ============================================================================
+void Profiler::GetFrameStats(float* average, float* p99) const
+{
+    ComputeStats(mFrameHistory, average, p99);
+}
+
+// ============================================================================
+// Historique des frames dans l'ordre chronologique
+// ============================================================================
+int Profiler::GetFrameHistory(float* out) const
+{
+    int start = (mHistoryCount < HISTORY_SIZE) ? 0 : mHistoryIndex;
+    for (int i = 0; i < mHistoryCount; i++)
+        out[i] = mFrameHistory[(start + i) % HISTORY_SIZE];
+
+    return mHistoryCount;
+}
+
+// ============================================================================
+// Nombre de frames enregistrées
+// ============================================================================
+int Profiler::GetFrameCount() const
+{
+    return mHistoryCount;
+}
+
+// ============================================================================
+// Moyennes depuis le démarrage
+// ============================================================================
+double Profiler::GetStageSessionAverage(ProfileStage stage) const
+{
+    if (mTotalFrames == 0)
+        return 0.0;
+
+    return mTotals[static_cast<int>(stage)] / mTotalFrames;
+}
+
+double Profiler::GetFrameSessionAverage() const
+{
+    if (mTotalFrames == 0)
+        return 0.0;
+
+    return mTotalFrameTime / mTotalFrames;
+}
+
+long long Profiler::GetSessionFrameCount() const
+{
+    return mTotalFrames;
+}
+
+// ============================================================================
+// Nom lisible d'une étape
+// ============================================================================
+const char* Profiler::GetStageName(ProfileStage stage)
+{
+    switch (stage)
+    {
+        case ProfileStage::Events:         return "Evenements";
+        case ProfileStage::Update:         return "Mise a jour";
+        case ProfileStage::Clear:          return "Effacement";
+        case ProfileStage::DrawHighlights: return "Surlignages";
+        case ProfileStage::DrawSelection:  return "Selection";
+        case ProfileStage::DrawGrid:       return "Grille";
+        case ProfileStage::DrawNumbers:    return "Chiffres";
+        case ProfileStage::UINewFrame:     return "UI NewFrame";
+        case ProfileStage::UIWindows:      return "UI Fenetres";
+        case ProfileStage::UIRender:       return "UI Render";
+        case ProfileStage::Present:        return "Present";
+        case ProfileStage::Count:          break;
+    }
+    return "?";
+}
+
+// ============================================================================
+// Affichage de l'overlay
+// ============================================================================
+void Profiler::ToggleOverlay()
+{
+    mOverlayVisible = !mOverlayVisible;
+}
+
+bool Profiler::IsOverlayVisible() const
+{
+    return mOverlayVisible;
+}
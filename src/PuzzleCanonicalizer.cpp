@@ -0,0 +1,379 @@
+// ============================================================================
+// PuzzleCanonicalizer.cpp
+// Implémentation de la forme canonique et de l'empreinte des grilles
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "../include/PuzzleCanonicalizer.h"
+#include "../include/SudokuGrid.h"
+#include <algorithm>
+#include <cstring>
+
+// Ordres possibles des colonnes : 6 ordres des piles x 6^3 ordres des
+// colonnes dans chaque pile
+static const int COLUMN_ORDER_COUNT = 6 * 6 * 6 * 6;
+
+// Les 6 permutations de trois éléments
+static const uint8_t PERMUTATIONS_3[6][3] = {
+    { 0, 1, 2 }, { 0, 2, 1 }, { 1, 0, 2 }, { 1, 2, 0 }, { 2, 0, 1 }, { 2, 1, 0 }
+};
+
+// Motif minimal d'une pile selon son nombre de cases remplies
+static const int MIN_STACK_PATTERN[4] = { 0, 1, 3, 7 };
+
+// ============================================================================
+// Table des ordres de colonnes (colonne source de chaque colonne canonique)
+// ============================================================================
+struct ColumnOrderTable
+{
+    uint8_t orders[COLUMN_ORDER_COUNT][GRID_SIZE];
+
+    // Permutations d'une pile qui poussent ses cases remplies à droite,
+    // pour chaque motif de 3 cases (bit 2 = première)
+    uint8_t rightAligning[8][6];
+    uint8_t rightAligningCount[8];
+
+    ColumnOrderTable()
+    {
+        int index = 0;
+        for (int stacks = 0; stacks < 6; stacks++)
+            for (int first = 0; first < 6; first++)
+                for (int second = 0; second < 6; second++)
+                    for (int third = 0; third < 6; third++)
+                    {
+                        const int inner[3] = { first, second, third };
+                        for (int s = 0; s < 3; s++)
+                        {
+                            int stack = PERMUTATIONS_3[stacks][s];
+                            for (int k = 0; k < 3; k++)
+                                orders[index][s * 3 + k] =
+                                    static_cast<uint8_t>(stack * 3 + PERMUTATIONS_3[inner[s]][k]);
+                        }
+                        index++;
+                    }
+
+        for (int pattern = 0; pattern < 8; pattern++)
+        {
+            rightAligningCount[pattern] = 0;
+            for (int permutation = 0; permutation < 6; permutation++)
+            {
+                int permuted = 0;
+                for (int k = 0; k < 3; k++)
+                {
+                    int bit = (pattern >> (2 - PERMUTATIONS_3[permutation][k])) & 1;
+                    permuted |= bit << (2 - k);
+                }
+                if (permuted == MIN_STACK_PATTERN[__builtin_popcount(pattern)])
+                    rightAligning[pattern][rightAligningCount[pattern]++] =
+                        static_cast<uint8_t>(permutation);
+            }
+        }
+    }
+};
+
+static const ColumnOrderTable sColumnOrders;
+
+// Au-delà de ce nombre de candidats, les doublons sont fusionnés (grilles
+// presque vides, où presque toutes les transformations sont à égalité)
+static const size_t MERGE_THRESHOLD = 4096;
+
+// ============================================================================
+// Constructeur
+// ============================================================================
+PuzzleCanonicalizer::PuzzleCanonicalizer()
+{
+    mCandidates.reserve(2 * COLUMN_ORDER_COUNT);
+    mNext.reserve(2 * COLUMN_ORDER_COUNT);
+}
+
+// ============================================================================
+// Première ligne. Ses chiffres sont tous différents : une fois renommés,
+// ils valent 1, 2, 3... dans l'ordre. La ligne ne dépend donc que du motif
+// de ses cases remplies, qui est minimal quand chaque pile pousse ses cases
+// remplies à droite et que les piles sont rangées de la moins remplie à la
+// plus remplie.
+// ============================================================================
+void PuzzleCanonicalizer::StartCandidates(int* canonical)
+{
+    // Motif de chaque pile de chaque ligne (bit 2 = première colonne)
+    int patterns[2][GRID_SIZE][3];
+    int rowBest[2][GRID_SIZE];
+    int best = 1 << GRID_SIZE;
+
+    for (int transposed = 0; transposed < 2; transposed++)
+    {
+        for (int row = 0; row < GRID_SIZE; row++)
+        {
+            const uint8_t* source = mSource[transposed] + row * GRID_SIZE;
+            int minimal[3];
+            for (int stack = 0; stack < 3; stack++)
+            {
+                int pattern = 0;
+                for (int k = 0; k < 3; k++)
+                    pattern |= (source[stack * 3 + k] != 0 ? 1 : 0) << (2 - k);
+                patterns[transposed][row][stack] = pattern;
+                minimal[stack] = MIN_STACK_PATTERN[__builtin_popcount(pattern)];
+            }
+
+            std::sort(minimal, minimal + 3);
+            rowBest[transposed][row] = (minimal[0] << 6) | (minimal[1] << 3) | minimal[2];
+            best = std::min(best, rowBest[transposed][row]);
+        }
+    }
+
+    // Candidats : lignes qui atteignent le motif minimal, avec chaque ordre
+    // de colonnes qui le produit
+    mCandidates.clear();
+    for (int transposed = 0; transposed < 2; transposed++)
+    {
+        for (int row = 0; row < GRID_SIZE; row++)
+        {
+            if (rowBest[transposed][row] != best)
+                continue;
+
+            // Ordres des piles qui rangent les piles comme le motif minimal,
+            // puis ordres internes qui poussent les cases remplies à droite
+            const int* stackPatterns = patterns[transposed][row];
+            for (int stacks = 0; stacks < 6; stacks++)
+            {
+                int pattern[3];
+                bool matches = true;
+                for (int s = 0; s < 3; s++)
+                {
+                    pattern[s] = stackPatterns[PERMUTATIONS_3[stacks][s]];
+                    if (MIN_STACK_PATTERN[__builtin_popcount(pattern[s])] != ((best >> (6 - 3 * s)) & 7))
+                        matches = false;
+                }
+                if (!matches)
+                    continue;
+
+                for (int i0 = 0; i0 < sColumnOrders.rightAligningCount[pattern[0]]; i0++)
+                    for (int i1 = 0; i1 < sColumnOrders.rightAligningCount[pattern[1]]; i1++)
+                        for (int i2 = 0; i2 < sColumnOrders.rightAligningCount[pattern[2]]; i2++)
+                        {
+                            int order = ((stacks * 6 + sColumnOrders.rightAligning[pattern[0]][i0]) * 6 +
+                                         sColumnOrders.rightAligning[pattern[1]][i1]) * 6 +
+                                        sColumnOrders.rightAligning[pattern[2]][i2];
+
+                            Candidate candidate;
+                            memset(&candidate, 0, sizeof(candidate));
+                            candidate.transposed = static_cast<uint8_t>(transposed);
+                            candidate.lastRow = static_cast<uint8_t>(row);
+                            candidate.columnOrder = static_cast<uint16_t>(order);
+                            candidate.placedRows = static_cast<uint16_t>(1 << row);
+                            candidate.nextLabel = 1;
+
+                            const uint8_t* source = mSource[transposed] + row * GRID_SIZE;
+                            const uint8_t* columns = sColumnOrders.orders[order];
+                            for (int col = 0; col < GRID_SIZE; col++)
+                            {
+                                uint8_t value = source[columns[col]];
+                                if (value != 0)
+                                    candidate.labels[value] = candidate.nextLabel++;
+                            }
+
+                            mCandidates.push_back(candidate);
+                        }
+            }
+        }
+    }
+
+    int label = 1;
+    for (int col = 0; col < GRID_SIZE; col++)
+        canonical[col] = ((best >> (GRID_SIZE - 1 - col)) & 1) ? label++ : 0;
+}
+
+// ============================================================================
+// Fusionne les candidats de même état : la suite ne dépend que de
+// l'orientation, de l'ordre des colonnes, des lignes déjà placées (la bande
+// en cours s'en déduit) et du renommage
+// ============================================================================
+void PuzzleCanonicalizer::MergeCandidates()
+{
+    auto less = [](const Candidate& a, const Candidate& b) {
+        if (a.transposed != b.transposed)
+            return a.transposed < b.transposed;
+        if (a.columnOrder != b.columnOrder)
+            return a.columnOrder < b.columnOrder;
+        if (a.placedRows != b.placedRows)
+            return a.placedRows < b.placedRows;
+        return memcmp(a.labels, b.labels, sizeof(a.labels)) < 0;
+    };
+    auto same = [](const Candidate& a, const Candidate& b) {
+        return a.transposed == b.transposed && a.columnOrder == b.columnOrder &&
+               a.placedRows == b.placedRows &&
+               memcmp(a.labels, b.labels, sizeof(a.labels)) == 0;
+    };
+
+    std::sort(mCandidates.begin(), mCandidates.end(), less);
+    mCandidates.erase(std::unique(mCandidates.begin(), mCandidates.end(), same),
+                      mCandidates.end());
+}
+
+// ============================================================================
+// Forme canonique : la grille est construite ligne par ligne. Pour chaque
+// ligne, seuls les candidats qui donnent la plus petite ligne possible sont
+// prolongés (le préfixe minimal d'une grille minimale est minimal).
+// ============================================================================
+void PuzzleCanonicalizer::Canonicalize(const int* cells, int* canonical)
+{
+    mFilledRows[0] = 0;
+    mFilledRows[1] = 0;
+    for (int row = 0; row < GRID_SIZE; row++)
+    {
+        for (int col = 0; col < GRID_SIZE; col++)
+        {
+            uint8_t value = static_cast<uint8_t>(cells[row * GRID_SIZE + col]);
+            mSource[0][row * GRID_SIZE + col] = value;
+            mSource[1][col * GRID_SIZE + row] = value;
+            if (value != 0)
+            {
+                mFilledRows[0] |= static_cast<uint16_t>(1 << row);
+                mFilledRows[1] |= static_cast<uint16_t>(1 << col);
+            }
+        }
+    }
+
+    StartCandidates(canonical);
+
+    for (int row = 1; row < GRID_SIZE; row++)
+    {
+        uint8_t best[GRID_SIZE];
+        bool hasBest = false;
+        mNext.clear();
+
+        for (const Candidate& candidate : mCandidates)
+        {
+            // Lignes source possibles : une ligne d'une bande libre en début
+            // de bande, sinon une ligne restante de la bande en cours
+            int firstRow = 0;
+            int lastRow = GRID_SIZE - 1;
+            if (row % 3 != 0)
+            {
+                firstRow = (candidate.lastRow / 3) * 3;
+                lastRow = firstRow + 2;
+            }
+
+            // Plus aucune case remplie à placer : toutes les suites sont
+            // identiques, une seule suffit
+            bool restIsEmpty = (mFilledRows[candidate.transposed] & ~candidate.placedRows) == 0;
+
+            const uint8_t* order = sColumnOrders.orders[candidate.columnOrder];
+
+            for (int source = firstRow; source <= lastRow; source++)
+            {
+                int band = 7 << ((source / 3) * 3);
+                if ((candidate.placedRows & (row % 3 == 0 ? band : (1 << source))) != 0)
+                    continue;
+
+                const uint8_t* sourceRow = mSource[candidate.transposed] + source * GRID_SIZE;
+                uint8_t labels[10];
+                memcpy(labels, candidate.labels, sizeof(labels));
+                uint8_t nextLabel = candidate.nextLabel;
+
+                // -1 : déjà plus petite, 0 : égale jusqu'ici, 1 : plus grande
+                int comparison = hasBest ? 0 : -1;
+                uint8_t line[GRID_SIZE];
+
+                for (int col = 0; col < GRID_SIZE; col++)
+                {
+                    uint8_t value = sourceRow[order[col]];
+                    if (value != 0 && labels[value] == 0)
+                        labels[value] = nextLabel++;
+                    line[col] = labels[value];
+
+                    if (comparison == 0)
+                    {
+                        if (line[col] < best[col])
+                            comparison = -1;
+                        else if (line[col] > best[col])
+                        {
+                            comparison = 1;
+                            break;
+                        }
+                    }
+                }
+
+                if (comparison <= 0)
+                {
+                    if (comparison < 0)
+                    {
+                        memcpy(best, line, sizeof(best));
+                        hasBest = true;
+                        mNext.clear();
+                    }
+
+                    Candidate extended = candidate;
+                    extended.lastRow = static_cast<uint8_t>(source);
+                    extended.placedRows |= static_cast<uint16_t>(1 << source);
+                    memcpy(extended.labels, labels, sizeof(labels));
+                    extended.nextLabel = nextLabel;
+                    mNext.push_back(extended);
+                }
+
+                if (restIsEmpty)
+                    break;
+            }
+        }
+
+        for (int col = 0; col < GRID_SIZE; col++)
+            canonical[row * GRID_SIZE + col] = best[col];
+
+        mCandidates.swap(mNext);
+        if (mCandidates.size() > MERGE_THRESHOLD)
+            MergeCandidates();
+    }
+}
+
+// ============================================================================
+// Forme canonique des cases initiales d'une SudokuGrid
+// ============================================================================
+void PuzzleCanonicalizer::Canonicalize(const SudokuGrid& grid, int* canonical)
+{
+    int cells[CELL_COUNT];
+    for (int i = 0; i < CELL_COUNT; i++)
+    {
+        int row = i / GRID_SIZE;
+        int col = i % GRID_SIZE;
+        cells[i] = grid.IsInitialCell(row, col) ? grid.GetCell(row, col) : 0;
+    }
+    Canonicalize(cells, canonical);
+}
+
+// ============================================================================
+// Empreinte de la forme canonique
+// ============================================================================
+uint64_t PuzzleCanonicalizer::Fingerprint(const int* cells)
+{
+    int canonical[CELL_COUNT];
+    Canonicalize(cells, canonical);
+    return Hash(canonical);
+}
+
+// ============================================================================
+// Mélange 64 bits (finaliseur de SplitMix64)
+// ============================================================================
+static uint64_t Mix(uint64_t value)
+{
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+// ============================================================================
+// Empreinte 64 bits : les cases sont regroupées par 16 (un quartet chacune)
+// puis mélangées mot par mot
+// ============================================================================
+uint64_t PuzzleCanonicalizer::Hash(const int* cells)
+{
+    uint64_t hash = 0x9E3779B97F4A7C15ull;
+    for (int first = 0; first < CELL_COUNT; first += 16)
+    {
+        uint64_t packed = 0;
+        for (int k = 0; k < 16 && first + k < CELL_COUNT; k++)
+            packed |= static_cast<uint64_t>(cells[first + k] & 0x0F) << (4 * k);
+        hash = Mix(hash ^ packed);
+    }
+    return hash;
+}
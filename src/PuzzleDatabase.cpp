@@ -0,0 +1,445 @@
+// ============================================================================
+// PuzzleDatabase.cpp
+// Implémentation de la base de grilles
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "../include/PuzzleDatabase.h"
+#include "../include/FingerprintSet.h"
+#include "../include/Log.h"
+#include "../include/PuzzleCanonicalizer.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(PuzzleDatabaseHeader) == 40, "En-tete de base inattendu");
+static_assert(sizeof(PuzzleDatabaseLevel) == 16, "Index de base inattendu");
+
+// Alignement du premier enregistrement
+static const uint64_t PUZZLE_DB_ALIGNMENT = 64;
+
+// Tampon de concaténation des fichiers temporaires de Build
+static const size_t PUZZLE_DB_COPY_BUFFER = 1 << 20;
+
+// ============================================================================
+// Constructeur
+// ============================================================================
+PuzzleDatabase::PuzzleDatabase()
+    : mData(nullptr), mSize(0), mHeader(nullptr), mLevels(nullptr), mRecords(nullptr)
+{
+}
+
+// ============================================================================
+// Destructeur
+// ============================================================================
+PuzzleDatabase::~PuzzleDatabase()
+{
+    Close();
+}
+
+// ============================================================================
+// Projette le fichier en mémoire et vérifie l'en-tête
+// ============================================================================
+bool PuzzleDatabase::Open(const std::string& path)
+{
+    Close();
+
+#if defined(_WIN32)
+    LOG_WARN("Base de grilles non supportee sur cette plateforme: %s", path.c_str());
+    return false;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(PuzzleDatabaseHeader))
+    {
+        LOG_WARN("Base de grilles invalide: %s", path.c_str());
+        close(fd);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(info.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // La projection reste valide
+    if (data == MAP_FAILED)
+    {
+        LOG_WARN("Impossible de projeter %s en memoire", path.c_str());
+        return false;
+    }
+
+    // Accès aléatoire : pas de lecture anticipée
+    madvise(data, size, MADV_RANDOM);
+
+    mData = static_cast<const unsigned char*>(data);
+    mSize = size;
+    mHeader = reinterpret_cast<const PuzzleDatabaseHeader*>(mData);
+
+    // Vérifie l'en-tête et que l'index et les enregistrements tiennent
+    // dans le fichier
+    const PuzzleDatabaseHeader& header = *mHeader;
+    uint64_t indexEnd = sizeof(PuzzleDatabaseHeader) +
+                        (uint64_t)header.levelCount * sizeof(PuzzleDatabaseLevel);
+    bool valid = memcmp(header.magic, PUZZLE_DB_MAGIC, sizeof(header.magic)) == 0 &&
+                 header.version == PUZZLE_DB_VERSION &&
+                 header.recordSize == PUZZLE_RECORD_SIZE &&
+                 header.levelCount == DIFFICULTY_COUNT &&
+                 indexEnd <= header.dataOffset &&
+                 header.dataOffset <= size &&
+                 header.count <= (size - header.dataOffset) / PUZZLE_RECORD_SIZE;
+
+    if (valid)
+    {
+        mLevels = reinterpret_cast<const PuzzleDatabaseLevel*>(mData + sizeof(PuzzleDatabaseHeader));
+        for (uint32_t level = 0; level < header.levelCount; level++)
+        {
+            if (mLevels[level].first > header.count ||
+                mLevels[level].count > header.count - mLevels[level].first)
+                valid = false;
+        }
+    }
+
+    if (!valid)
+    {
+        LOG_WARN("Base de grilles invalide: %s", path.c_str());
+        Close();
+        return false;
+    }
+
+    mRecords = mData + header.dataOffset;
+    LOG_INFO("Base de grilles: %s (%llu grilles)", path.c_str(),
+             (unsigned long long)header.count);
+    return true;
+#endif
+}
+
+// ============================================================================
+// Libère la projection
+// ============================================================================
+void PuzzleDatabase::Close()
+{
+#if !defined(_WIN32)
+    if (mData)
+        munmap(const_cast<unsigned char*>(mData), mSize);
+#endif
+
+    mData = nullptr;
+    mSize = 0;
+    mHeader = nullptr;
+    mLevels = nullptr;
+    mRecords = nullptr;
+}
+
+// ============================================================================
+// Base ouverte ?
+// ============================================================================
+bool PuzzleDatabase::IsOpen() const
+{
+    return mData != nullptr;
+}
+
+// ============================================================================
+// Nombre de grilles
+// ============================================================================
+uint64_t PuzzleDatabase::GetCount() const
+{
+    return mHeader ? mHeader->count : 0;
+}
+
+uint64_t PuzzleDatabase::GetCount(int difficulty) const
+{
+    if (!mHeader || difficulty < 0 || difficulty >= DIFFICULTY_COUNT)
+        return 0;
+    return mLevels[difficulty].count;
+}
+
+// ============================================================================
+// Décode une grille par son index
+// ============================================================================
+bool PuzzleDatabase::GetPuzzle(uint64_t index, int* cells) const
+{
+    if (!mHeader || index >= mHeader->count)
+        return false;
+
+    return DecodeRecord(mRecords + index * PUZZLE_RECORD_SIZE, cells);
+}
+
+// ============================================================================
+// Décode une grille d'un niveau de difficulté
+// ============================================================================
+bool PuzzleDatabase::GetPuzzle(int difficulty, uint64_t index, int* cells) const
+{
+    if (index >= GetCount(difficulty))
+        return false;
+    return GetPuzzle(mLevels[difficulty].first + index, cells);
+}
+
+// ============================================================================
+// Encode une grille en enregistrement de 41 octets
+// ============================================================================
+void PuzzleDatabase::EncodeRecord(const int* cells, unsigned char* record)
+{
+    memset(record, 0, PUZZLE_RECORD_SIZE);
+    for (int i = 0; i < CELL_COUNT; i++)
+        record[i / 2] |= static_cast<unsigned char>(cells[i] << ((i % 2) * 4));
+}
+
+// ============================================================================
+// Décode un enregistrement de 41 octets. Faux si une case sort de 0 à 9 :
+// la grille ne doit atteindre ni SudokuGrid ni le solveur.
+// ============================================================================
+bool PuzzleDatabase::DecodeRecord(const unsigned char* record, int* cells)
+{
+    bool valid = true;
+    for (int i = 0; i < CELL_COUNT; i++)
+    {
+        unsigned char packed = record[i / 2];
+        cells[i] = (i % 2 == 0) ? (packed & 0x0F) : (packed >> 4);
+        valid = valid && cells[i] <= GRID_SIZE;
+    }
+    return valid;
+}
+
+// ============================================================================
+// Fichier temporaire des enregistrements d'un thread pour un niveau
+// ============================================================================
+static std::string PartPath(const std::string& path, int thread, int level)
+{
+    return path + ".tmp." + std::to_string(thread) + "." + std::to_string(level);
+}
+
+// ============================================================================
+// Ajoute le contenu d'un fichier à "output". Faux en cas d'erreur.
+// ============================================================================
+static bool AppendFile(const std::string& path, FILE* output, std::vector<unsigned char>& buffer)
+{
+    FILE* input = fopen(path.c_str(), "rb");
+    if (!input)
+        return false;
+
+    bool ok = true;
+    size_t count;
+    while (ok && (count = fread(buffer.data(), 1, buffer.size(), input)) > 0)
+        ok = fwrite(buffer.data(), 1, count, output) == count;
+
+    ok = ok && !ferror(input);
+    fclose(input);
+    return ok;
+}
+
+// ============================================================================
+// Génère et écrit une base de grilles
+// ============================================================================
+bool PuzzleDatabase::Build(const std::string& path, uint64_t count, unsigned int seed, int threads,
+                           PuzzleDatabaseBuildStats& stats, PuzzleDatabaseProgress progress)
+{
+    memset(&stats, 0, sizeof(stats));
+
+    if (threads < 1)
+        threads = 1;
+
+    // Chaque thread écrit dans ses propres fichiers par niveau (aucun
+    // partage, rien en mémoire), concaténés par niveau à la fin. Les
+    // grilles équivalentes (mêmes à une symétrie près) sont écartées dès
+    // leur génération grâce à l'ensemble d'empreintes partagé.
+    std::vector<FILE*> parts(threads * DIFFICULTY_COUNT, nullptr);
+    std::vector<uint64_t> partCounts(threads * DIFFICULTY_COUNT, 0);
+
+    auto removeParts = [&]() {
+        for (int t = 0; t < threads; t++)
+        {
+            for (int level = 0; level < DIFFICULTY_COUNT; level++)
+            {
+                FILE*& part = parts[t * DIFFICULTY_COUNT + level];
+                if (part)
+                    fclose(part);
+                part = nullptr;
+                remove(PartPath(path, t, level).c_str());
+            }
+        }
+    };
+
+    for (int t = 0; t < threads; t++)
+    {
+        for (int level = 0; level < DIFFICULTY_COUNT; level++)
+        {
+            std::string partPath = PartPath(path, t, level);
+            FILE* part = fopen(partPath.c_str(), "wb");
+            if (!part)
+            {
+                LOG_ERROR("Impossible d'ecrire %s", partPath.c_str());
+                removeParts();
+                return false;
+            }
+            parts[t * DIFFICULTY_COUNT + level] = part;
+        }
+    }
+
+    FingerprintSet fingerprints(count);
+    std::atomic<uint64_t> generated(0);
+    std::atomic<bool> writeFailed(false);
+    std::vector<std::thread> workers;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (int t = 0; t < threads; t++)
+    {
+        uint64_t share = count / threads + (static_cast<uint64_t>(t) < count % threads ? 1 : 0);
+
+        workers.emplace_back([&parts, &partCounts, &fingerprints, &generated, &writeFailed, t,
+                              share, seed, count, progress]() {
+            PuzzleGenerator generator(seed + t);
+            PuzzleCanonicalizer canonicalizer;
+            int cells[CELL_COUNT];
+            unsigned char record[PUZZLE_RECORD_SIZE];
+
+            uint64_t produced = 0;
+            while (produced < share && !writeFailed.load(std::memory_order_relaxed))
+            {
+                generator.Generate(cells);
+                int level = PuzzleGenerator::Grade(cells);
+                if (level < 0)
+                    continue; // Impossible : le générateur garantit l'unicité
+
+                // Doublon : la grille est remplacée par une autre
+                if (!fingerprints.Insert(canonicalizer.Fingerprint(cells)))
+                    continue;
+
+                EncodeRecord(cells, record);
+                int part = t * DIFFICULTY_COUNT + level;
+                if (fwrite(record, 1, PUZZLE_RECORD_SIZE, parts[part]) != PUZZLE_RECORD_SIZE)
+                {
+                    writeFailed.store(true, std::memory_order_relaxed);
+                    break;
+                }
+                partCounts[part]++;
+                produced++;
+
+                uint64_t done = generated.fetch_add(1) + 1;
+                if (progress && count >= 10 && done % (count / 10) == 0)
+                    progress(done, count);
+            }
+        });
+    }
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    bool partsOk = !writeFailed.load();
+    for (FILE*& part : parts)
+    {
+        partsOk = (fclose(part) == 0) && partsOk;
+        part = nullptr;
+    }
+    if (!partsOk)
+    {
+        LOG_ERROR("Echec de l'ecriture des fichiers temporaires de %s", path.c_str());
+        removeParts();
+        return false;
+    }
+
+    // En-tête et index : enregistrements regroupés par niveau
+    PuzzleDatabaseHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, PUZZLE_DB_MAGIC, sizeof(header.magic));
+    header.version = PUZZLE_DB_VERSION;
+    header.recordSize = PUZZLE_RECORD_SIZE;
+    header.levelCount = DIFFICULTY_COUNT;
+
+    uint64_t indexEnd = sizeof(header) + DIFFICULTY_COUNT * sizeof(PuzzleDatabaseLevel);
+    header.dataOffset = (indexEnd + PUZZLE_DB_ALIGNMENT - 1) / PUZZLE_DB_ALIGNMENT * PUZZLE_DB_ALIGNMENT;
+
+    PuzzleDatabaseLevel levels[DIFFICULTY_COUNT];
+    uint64_t first = 0;
+    for (int level = 0; level < DIFFICULTY_COUNT; level++)
+    {
+        levels[level].first = first;
+        levels[level].count = 0;
+        for (int t = 0; t < threads; t++)
+            levels[level].count += partCounts[t * DIFFICULTY_COUNT + level];
+        first += levels[level].count;
+    }
+    header.count = first;
+
+    // Écriture dans un fichier temporaire puis renommage : une base
+    // existante n'est jamais laissée à moitié écrite
+    std::string temporary = path + ".tmp";
+    FILE* file = fopen(temporary.c_str(), "wb");
+    if (!file)
+    {
+        LOG_ERROR("Impossible d'ecrire %s", temporary.c_str());
+        removeParts();
+        return false;
+    }
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(levels, sizeof(levels), 1, file) == 1;
+
+    static const char padding[PUZZLE_DB_ALIGNMENT] = {};
+    ok = ok && fwrite(padding, 1, header.dataOffset - indexEnd, file) == header.dataOffset - indexEnd;
+
+    std::vector<unsigned char> buffer(PUZZLE_DB_COPY_BUFFER);
+    for (int level = 0; level < DIFFICULTY_COUNT && ok; level++)
+    {
+        for (int t = 0; t < threads && ok; t++)
+            ok = AppendFile(PartPath(path, t, level), file, buffer);
+    }
+
+    ok = (fclose(file) == 0) && ok;
+    removeParts();
+    if (!ok || rename(temporary.c_str(), path.c_str()) != 0)
+    {
+        LOG_ERROR("Echec de l'ecriture de %s", path.c_str());
+        remove(temporary.c_str());
+        return false;
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    stats.count = header.count;
+    for (int level = 0; level < DIFFICULTY_COUNT; level++)
+        stats.levelCounts[level] = levels[level].count;
+    stats.duplicateCount = fingerprints.GetDuplicateCount();
+    stats.duplicateRate = fingerprints.GetDuplicateRate();
+    stats.overflowCount = fingerprints.GetOverflowCount();
+    stats.seconds = elapsed.count();
+    return true;
+}
+
+// ============================================================================
+// Source de grilles tirées au hasard dans une base
+// ============================================================================
+DatabasePuzzleSource::DatabasePuzzleSource(const PuzzleDatabase& database, int difficulty)
+    : mDatabase(database), mDifficulty(difficulty),
+      mRandom(static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()))
+{
+}
+
+bool DatabasePuzzleSource::NextPuzzle(int* cells)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    uint64_t count = (mDifficulty < 0) ? mDatabase.GetCount() : mDatabase.GetCount(mDifficulty);
+    if (count == 0)
+        return false;
+
+    // Enregistrement invalide : faux, la grille est générée à la place
+    uint64_t index = std::uniform_int_distribution<uint64_t>(0, count - 1)(mRandom);
+    bool ok = (mDifficulty < 0) ? mDatabase.GetPuzzle(index, cells)
+                                : mDatabase.GetPuzzle(mDifficulty, index, cells);
+    if (!ok)
+        LOG_WARN("Grille invalide dans la base (index %llu)", (unsigned long long)index);
+    return ok;
+}
@@ -0,0 +1,201 @@
+// ============================================================================
+// PuzzleGenerator.cpp
+// Implémentation du générateur de grilles
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "../include/PuzzleGenerator.h"
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+
+const char* const DIFFICULTY_NAMES[DIFFICULTY_COUNT] = {
+    "Facile", "Moyen", "Difficile", "Expert"
+};
+
+// Domaine des graines des grilles du jour ("JOUR" en ASCII). Tient sur 32
+// bits : décalé dans la moitié haute, il ne recouvre pas le numéro du jour.
+static const uint64_t DAILY_SEED_TAG = 0x4A4F5552ULL;
+
+// Nœuds de recherche (unicité comprise) au-delà desquels une grille passe
+// au niveau suivant : environ un quart des grilles générées par niveau
+static const long long GRADE_THRESHOLDS[DIFFICULTY_COUNT - 1] = { 200, 400, 800 };
+
+// ============================================================================
+// Chiffres encore possibles pour une case (bit n-1 = chiffre n)
+// ============================================================================
+static int CandidatesOf(const int* cells, int cell)
+{
+    int row = cell / GRID_SIZE;
+    int col = cell % GRID_SIZE;
+    int boxRow = (row / 3) * 3;
+    int boxCol = (col / 3) * 3;
+    int used = 0;
+
+    for (int i = 0; i < GRID_SIZE; i++)
+    {
+        used |= 1 << cells[row * GRID_SIZE + i];
+        used |= 1 << cells[i * GRID_SIZE + col];
+        used |= 1 << cells[(boxRow + i / 3) * GRID_SIZE + boxCol + i % 3];
+    }
+
+    // Le bit 0 (case vide) est écarté
+    return (~used >> 1) & 0x1FF;
+}
+
+// ============================================================================
+// Constructeur
+// ============================================================================
+PuzzleGenerator::PuzzleGenerator(uint64_t seed) : mRandom(seed)
+{
+}
+
+// ============================================================================
+// Grille complète aléatoire : les trois blocs de la diagonale sont
+// indépendants, on les remplit au hasard puis le solveur complète
+// ============================================================================
+void PuzzleGenerator::GenerateSolution(int* cells)
+{
+    std::fill(cells, cells + CELL_COUNT, 0);
+
+    int digits[GRID_SIZE] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    for (int box = 0; box < 3; box++)
+    {
+        mRandom.Shuffle(digits, GRID_SIZE);
+        for (int i = 0; i < GRID_SIZE; i++)
+        {
+            int row = box * 3 + i / 3;
+            int col = box * 3 + i % 3;
+            cells[row * GRID_SIZE + col] = digits[i];
+        }
+    }
+
+    mSolver.Solve(cells);
+}
+
+// ============================================================================
+// Génère une grille minimale à solution unique
+// ============================================================================
+void PuzzleGenerator::Generate(int* cells)
+{
+    GenerateSolution(cells);
+
+    // Retire les cases dans un ordre aléatoire tant que la solution reste unique
+    int order[CELL_COUNT];
+    for (int i = 0; i < CELL_COUNT; i++)
+        order[i] = i;
+    mRandom.Shuffle(order, CELL_COUNT);
+
+    for (int i = 0; i < CELL_COUNT; i++)
+    {
+        int cell = order[i];
+        int value = cells[cell];
+        cells[cell] = 0;
+
+        // La grille avait une seule solution, où la case vaut "value" : une
+        // seconde solution existe si et seulement si un autre chiffre possible
+        // pour la case mène à une solution. Chaque essai s'arrête à la
+        // première solution, et un chiffre imposé coupe tôt la recherche.
+        int candidates = CandidatesOf(cells, cell) & ~(1 << (value - 1));
+        bool unique = true;
+        while (candidates != 0 && unique)
+        {
+            int bit = candidates & -candidates;
+            candidates ^= bit;
+
+            cells[cell] = __builtin_ctz(bit) + 1;
+            unique = mSolver.CountSolutions(cells, 1) == 0;
+        }
+
+        cells[cell] = unique ? 0 : value;
+    }
+}
+
+// ============================================================================
+// Grille n° "number"
+// ============================================================================
+void PuzzleGenerator::GenerateNumbered(uint64_t number, int* cells)
+{
+    // Numéros consécutifs : graines sans corrélation, et une autre suite de
+    // grilles pour chaque version de l'algorithme
+    uint64_t seed = PuzzleRandom::Mix(number + PuzzleRandom::Mix(PUZZLE_ALGORITHM_VERSION));
+    PuzzleGenerator generator(seed);
+    generator.Generate(cells);
+}
+
+// ============================================================================
+// Grille du jour "day"
+// ============================================================================
+void PuzzleGenerator::GenerateDaily(uint64_t day, int* cells)
+{
+    uint64_t seed = PuzzleRandom::Mix(PuzzleRandom::Mix(day ^ (DAILY_SEED_TAG << 32)) +
+                                      PuzzleRandom::Mix(PUZZLE_ALGORITHM_VERSION));
+    PuzzleGenerator generator(seed);
+    generator.Generate(cells);
+}
+
+// ============================================================================
+// Jour d'une date (jours depuis le 1er janvier 1970)
+// ============================================================================
+int64_t PuzzleGenerator::DayNumber(int year, int month, int day)
+{
+    static const int DAYS_IN_MONTH[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+    if (year < 1970 || month < 1 || month > 12 || day < 1)
+        return -1;
+
+    bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    int monthDays = DAYS_IN_MONTH[month - 1] + (month == 2 && leap ? 1 : 0);
+    if (day > monthDays)
+        return -1;
+
+    // Année commençant en mars : le jour bissextile tombe en fin d'année
+    int64_t y = month <= 2 ? year - 1 : year;
+    int64_t era = y / 400;
+    int64_t yearOfEra = y - era * 400;
+    int64_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+// ============================================================================
+// Jour d'une date "AAAA-MM-JJ" (vide = aujourd'hui)
+// ============================================================================
+int64_t PuzzleGenerator::DayNumber(const char* date)
+{
+    int year, month, day;
+    if (date[0] == '\0')
+    {
+        time_t now = time(nullptr);
+        const tm* local = localtime(&now);
+        if (!local)
+            return -1;
+        year = local->tm_year + 1900;
+        month = local->tm_mon + 1;
+        day = local->tm_mday;
+    }
+    else
+    {
+        char end;
+        if (sscanf(date, "%d-%d-%d%c", &year, &month, &day, &end) != 3)
+            return -1;
+    }
+    return DayNumber(year, month, day);
+}
+
+// ============================================================================
+// Difficulté estimée d'une grille
+// ============================================================================
+int PuzzleGenerator::Grade(const int* cells)
+{
+    SudokuSolver solver;
+    if (solver.CountSolutions(cells, 2) != 1)
+        return -1;
+
+    long long nodes = solver.GetNodeCount();
+    int level = 0;
+    while (level < DIFFICULTY_COUNT - 1 && nodes > GRADE_THRESHOLDS[level])
+        level++;
+    return level;
+}
@@ -0,0 +1,92 @@
+// ============================================================================
+// PuzzleRandom.cpp
+// Implémentation du générateur pseudo-aléatoire portable
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "../include/PuzzleRandom.h"
+
+// ============================================================================
+// Rotation à gauche
+// ============================================================================
+static inline uint64_t RotateLeft(uint64_t value, int bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+// ============================================================================
+// Constructeur : quatre valeurs SplitMix64 successives (jamais toutes nulles)
+// ============================================================================
+PuzzleRandom::PuzzleRandom(uint64_t seed)
+{
+    for (int i = 0; i < 4; i++)
+    {
+        seed += 0x9E3779B97F4A7C15ULL;
+        mState[i] = Mix(seed);
+    }
+}
+
+// ============================================================================
+// Étape de mélange de SplitMix64
+// ============================================================================
+uint64_t PuzzleRandom::Mix(uint64_t value)
+{
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+// ============================================================================
+// xoshiro256**
+// ============================================================================
+uint64_t PuzzleRandom::Next()
+{
+    uint64_t result = RotateLeft(mState[1] * 5, 7) * 9;
+    uint64_t shifted = mState[1] << 17;
+
+    mState[2] ^= mState[0];
+    mState[3] ^= mState[1];
+    mState[1] ^= mState[2];
+    mState[0] ^= mState[3];
+    mState[2] ^= shifted;
+    mState[3] = RotateLeft(mState[3], 45);
+
+    return result;
+}
+
+// ============================================================================
+// Tirage borné par multiplication (Lemire) : les tirages qui tomberaient
+// dans la zone biaisée sont recommencés
+// ============================================================================
+uint32_t PuzzleRandom::Below(uint32_t bound)
+{
+    uint64_t product = (Next() >> 32) * bound;
+    uint32_t low = static_cast<uint32_t>(product);
+
+    if (low < bound)
+    {
+        uint32_t threshold = (0u - bound) % bound;
+        while (low < threshold)
+        {
+            product = (Next() >> 32) * bound;
+            low = static_cast<uint32_t>(product);
+        }
+    }
+
+    return static_cast<uint32_t>(product >> 32);
+}
+
+// ============================================================================
+// Mélange de Fisher-Yates (de la fin vers le début)
+// ============================================================================
+void PuzzleRandom::Shuffle(int* values, int count)
+{
+    for (int i = count - 1; i > 0; i--)
+    {
+        int j = static_cast<int>(Below(static_cast<uint32_t>(i + 1)));
+        int value = values[i];
+        values[i] = values[j];
+        values[j] = value;
+    }
+}
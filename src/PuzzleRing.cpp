@@ -0,0 +1,321 @@
+// ============================================================================
+// PuzzleRing.cpp
+// Implémentation de l'anneau de grilles en mémoire partagée
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "../include/PuzzleRing.h"
+#include "../include/Log.h"
+#include <cstring>
+#include <new>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(PuzzleRingHeader) == 192, "En-tete d'anneau inattendu");
+static_assert(sizeof(PuzzleRingSlot) == 64, "Case d'anneau inattendue");
+
+// Taille minimale de l'anneau
+static const uint64_t MIN_RING_CAPACITY = 16;
+
+// ============================================================================
+// Constructeur
+// ============================================================================
+PuzzleRing::PuzzleRing()
+    : mData(nullptr), mSize(0), mHeader(nullptr), mSlots(nullptr), mMask(0), mOwner(false)
+{
+}
+
+// ============================================================================
+// Destructeur
+// ============================================================================
+PuzzleRing::~PuzzleRing()
+{
+    Close();
+}
+
+// ============================================================================
+// Crée le segment, initialise les cases puis publie l'en-tête
+// ============================================================================
+bool PuzzleRing::Create(const std::string& name, uint64_t capacity)
+{
+    Close();
+
+#if defined(_WIN32)
+    LOG_WARN("Anneau de grilles non supporte sur cette plateforme: %s", name.c_str());
+    return false;
+#else
+    uint64_t slots = MIN_RING_CAPACITY;
+    while (slots < capacity)
+        slots *= 2;
+    size_t size = sizeof(PuzzleRingHeader) + slots * sizeof(PuzzleRingSlot);
+
+    // Un ancien anneau du même nom est remplacé (ses consommateurs gardent
+    // leur projection de l'ancien segment)
+    shm_unlink(name.c_str());
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0)
+    {
+        LOG_ERROR("Impossible de creer l'anneau %s", name.c_str());
+        return false;
+    }
+
+    void* data = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(size)) == 0)
+        data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd); // La projection reste valide
+    if (data == MAP_FAILED)
+    {
+        LOG_ERROR("Impossible de projeter l'anneau %s", name.c_str());
+        shm_unlink(name.c_str());
+        return false;
+    }
+
+    mData = static_cast<unsigned char*>(data);
+    mSize = size;
+    mName = name;
+    mOwner = true;
+
+    // Segment neuf (rempli de zéros) : construit les atomiques sur place
+    mHeader = new (mData) PuzzleRingHeader();
+    memcpy(mHeader->magic, PUZZLE_RING_MAGIC, sizeof(mHeader->magic));
+    mHeader->version = PUZZLE_RING_VERSION;
+    mHeader->slotSize = sizeof(PuzzleRingSlot);
+    mHeader->capacity = slots;
+    mHeader->head.store(0, std::memory_order_relaxed);
+    mHeader->tail.store(0, std::memory_order_relaxed);
+    mHeader->retired.store(0, std::memory_order_relaxed);
+
+    mSlots = reinterpret_cast<PuzzleRingSlot*>(mData + sizeof(PuzzleRingHeader));
+    for (uint64_t i = 0; i < slots; i++)
+    {
+        PuzzleRingSlot* slot = new (&mSlots[i]) PuzzleRingSlot();
+        slot->sequence.store(i, std::memory_order_relaxed);
+    }
+    mMask = slots - 1;
+
+    // Publication en dernier : un consommateur qui voit "ready" voit tout
+    // le reste
+    mHeader->ready.store(1, std::memory_order_release);
+
+    LOG_INFO("Anneau de grilles: %s (%llu cases)", name.c_str(), (unsigned long long)slots);
+    return true;
+#endif
+}
+
+// ============================================================================
+// Projette un anneau existant et vérifie l'en-tête
+// ============================================================================
+bool PuzzleRing::Open(const std::string& name)
+{
+    Close();
+
+#if defined(_WIN32)
+    LOG_WARN("Anneau de grilles non supporte sur cette plateforme: %s", name.c_str());
+    return false;
+#else
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(PuzzleRingHeader))
+    {
+        LOG_WARN("Anneau de grilles invalide: %s", name.c_str());
+        close(fd);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(info.st_size);
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        LOG_WARN("Impossible de projeter l'anneau %s", name.c_str());
+        return false;
+    }
+
+    mData = static_cast<unsigned char*>(data);
+    mSize = size;
+    mHeader = reinterpret_cast<PuzzleRingHeader*>(mData);
+    mName = name;
+
+    // "ready" d'abord : le reste de l'en-tête n'est lu qu'une fois publié
+    bool valid = mHeader->ready.load(std::memory_order_acquire) == 1 &&
+                 memcmp(mHeader->magic, PUZZLE_RING_MAGIC, sizeof(mHeader->magic)) == 0;
+
+    uint64_t capacity = mHeader->capacity;
+    valid = valid &&
+            mHeader->version == PUZZLE_RING_VERSION &&
+            mHeader->slotSize == sizeof(PuzzleRingSlot) &&
+            capacity >= MIN_RING_CAPACITY && (capacity & (capacity - 1)) == 0 &&
+            capacity <= (size - sizeof(PuzzleRingHeader)) / sizeof(PuzzleRingSlot);
+    if (!valid)
+    {
+        LOG_WARN("Anneau de grilles invalide: %s", name.c_str());
+        Close();
+        return false;
+    }
+
+    mSlots = reinterpret_cast<PuzzleRingSlot*>(mData + sizeof(PuzzleRingHeader));
+    mMask = capacity - 1;
+    LOG_INFO("Anneau de grilles: %s (%llu grilles disponibles)", name.c_str(),
+             (unsigned long long)GetCount());
+    return true;
+#endif
+}
+
+// ============================================================================
+// Libère la projection
+// ============================================================================
+void PuzzleRing::Close()
+{
+#if !defined(_WIN32)
+    // Les consommateurs qui gardent ce segment le rouvriront par son nom
+    if (mOwner && mHeader)
+        mHeader->retired.store(1, std::memory_order_release);
+    if (mData)
+        munmap(mData, mSize);
+    if (mOwner)
+        shm_unlink(mName.c_str());
+#endif
+
+    mData = nullptr;
+    mSize = 0;
+    mHeader = nullptr;
+    mSlots = nullptr;
+    mMask = 0;
+    mName.clear();
+    mOwner = false;
+}
+
+// ============================================================================
+// Anneau ouvert ?
+// ============================================================================
+bool PuzzleRing::IsOpen() const
+{
+    return mData != nullptr;
+}
+
+// ============================================================================
+// Segment abandonné par son producteur ?
+// ============================================================================
+bool PuzzleRing::IsRetired() const
+{
+    return mHeader && mHeader->retired.load(std::memory_order_acquire) == 1;
+}
+
+const std::string& PuzzleRing::GetName() const
+{
+    return mName;
+}
+
+// ============================================================================
+// Publie une grille (un seul producteur)
+// ============================================================================
+bool PuzzleRing::Push(const int* cells)
+{
+    if (!mHeader)
+        return false;
+
+    uint64_t position = mHeader->head.load(std::memory_order_relaxed);
+    PuzzleRingSlot& slot = mSlots[position & mMask];
+
+    // Case pas encore rendue par son consommateur : anneau plein
+    if (slot.sequence.load(std::memory_order_acquire) != position)
+        return false;
+
+    PuzzleDatabase::EncodeRecord(cells, slot.record);
+    slot.sequence.store(position + 1, std::memory_order_release);
+    mHeader->head.store(position + 1, std::memory_order_relaxed);
+    return true;
+}
+
+// ============================================================================
+// Prend la plus ancienne grille publiée
+// ============================================================================
+bool PuzzleRing::Pop(int* cells)
+{
+    if (!mHeader)
+        return false;
+
+    uint64_t position = mHeader->tail.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        PuzzleRingSlot& slot = mSlots[position & mMask];
+        uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        int64_t difference = static_cast<int64_t>(sequence - (position + 1));
+
+        if (difference < 0)
+            return false; // Pas encore publiée : anneau vide
+
+        if (difference == 0)
+        {
+            // Réserve la position ; en cas d'échec, "position" reçoit celle
+            // d'un consommateur plus rapide
+            if (mHeader->tail.compare_exchange_weak(position, position + 1,
+                                                    std::memory_order_relaxed))
+            {
+                // Case rendue même si la grille est invalide (écartée)
+                bool valid = PuzzleDatabase::DecodeRecord(slot.record, cells);
+                slot.sequence.store(position + mMask + 1, std::memory_order_release);
+                return valid;
+            }
+        }
+        else
+        {
+            // Case déjà prise par un autre consommateur
+            position = mHeader->tail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+// ============================================================================
+// Compteurs
+// ============================================================================
+uint64_t PuzzleRing::GetCount() const
+{
+    if (!mHeader)
+        return 0;
+
+    uint64_t tail = mHeader->tail.load(std::memory_order_relaxed);
+    uint64_t head = mHeader->head.load(std::memory_order_relaxed);
+    return head > tail ? head - tail : 0;
+}
+
+uint64_t PuzzleRing::GetCapacity() const
+{
+    return mHeader ? mMask + 1 : 0;
+}
+
+// ============================================================================
+// Source de grilles : l'anneau, puis la source de secours
+// ============================================================================
+RingPuzzleSource::RingPuzzleSource(PuzzleRing& ring, const std::string& name,
+                                   PuzzleSource* fallback)
+    : mRing(ring), mFallback(fallback), mName(name)
+{
+}
+
+bool RingPuzzleSource::NextPuzzle(int* cells)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (mRing.Pop(cells))
+        return true;
+
+    // Pas encore ouvert, producteur arrêté ou anneau recréé : projette le
+    // segment actuel (s'il n'existe pas, l'anneau reste fermé et sera
+    // réessayé au prochain appel)
+    if (mRing.IsRetired() || !mRing.IsOpen())
+    {
+        if (mRing.Open(mName) && mRing.Pop(cells))
+            return true;
+    }
+    return mFallback && mFallback->NextPuzzle(cells);
+}
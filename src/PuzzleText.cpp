@@ -0,0 +1,430 @@
+// ============================================================================
+// PuzzleText.cpp
+// Implémentation de la lecture / écriture en flux du format texte
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "../include/PuzzleText.h"
+#include "../include/SudokuGrid.h"
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define PUZZLE_TEXT_SSE2 1
+#else
+#define PUZZLE_TEXT_SSE2 0
+#endif
+
+// ============================================================================
+// Constructeur
+// ============================================================================
+PuzzleReader::PuzzleReader()
+    : mFile(nullptr), mOwnsFile(false), mStart(0), mEnd(0), mEndOfFile(false),
+      mLineNumber(0), mInvalidCount(0), mBytesRead(0)
+{
+}
+
+// ============================================================================
+// Destructeur
+// ============================================================================
+PuzzleReader::~PuzzleReader()
+{
+    Close();
+}
+
+// ============================================================================
+// Ouvre un fichier ("-" = entrée standard)
+// ============================================================================
+bool PuzzleReader::Open(const std::string& path)
+{
+    Close();
+
+    if (path == "-")
+    {
+        mFile = stdin;
+        mOwnsFile = false;
+    }
+    else
+    {
+        mFile = fopen(path.c_str(), "rb");
+        mOwnsFile = true;
+        if (!mFile)
+            return false;
+    }
+
+    // Les blocs sont déjà gros : pas de second tampon dans la libc
+    setvbuf(mFile, nullptr, _IONBF, 0);
+
+    mBuffer.resize(PUZZLE_TEXT_CHUNK_SIZE);
+    mStart = 0;
+    mEnd = 0;
+    mEndOfFile = false;
+    mLineNumber = 0;
+    mInvalidCount = 0;
+    mBytesRead = 0;
+    return true;
+}
+
+// ============================================================================
+// Ferme le fichier
+// ============================================================================
+void PuzzleReader::Close()
+{
+    if (mFile && mOwnsFile)
+        fclose(mFile);
+    mFile = nullptr;
+}
+
+// ============================================================================
+// Recharge le tampon en conservant la ligne incomplète
+// ============================================================================
+bool PuzzleReader::Refill()
+{
+    if (mEndOfFile || !mFile)
+        return false;
+
+    // Ramène le reste de la ligne en début de tampon
+    size_t remaining = mEnd - mStart;
+    if (remaining > 0 && mStart > 0)
+        memmove(mBuffer.data(), mBuffer.data() + mStart, remaining);
+    mStart = 0;
+    mEnd = remaining;
+
+    size_t count = fread(mBuffer.data() + mEnd, 1, mBuffer.size() - mEnd, mFile);
+    if (count == 0)
+    {
+        mEndOfFile = true;
+        return false;
+    }
+
+    mEnd += count;
+    mBytesRead += count;
+    return true;
+}
+
+// ============================================================================
+// Lit la prochaine grille valide
+// ============================================================================
+bool PuzzleReader::Next(int* cells)
+{
+    for (;;)
+    {
+        // Cherche la fin de la ligne courante, en rechargeant si besoin
+        const char* newline = static_cast<const char*>(
+            memchr(mBuffer.data() + mStart, '\n', mEnd - mStart));
+
+        if (!newline)
+        {
+            // Ligne plus longue que le tampon : invalide, on saute la suite
+            if (mStart == 0 && mEnd == mBuffer.size())
+            {
+                mInvalidCount++;
+                mStart = mEnd;
+                while (Refill())
+                {
+                    newline = static_cast<const char*>(memchr(mBuffer.data(), '\n', mEnd));
+                    if (newline)
+                    {
+                        mStart = newline - mBuffer.data() + 1;
+                        break;
+                    }
+                    mStart = mEnd;
+                }
+                mLineNumber++;
+                continue;
+            }
+
+            if (Refill())
+                continue;
+
+            // Fin du fichier : dernière ligne sans retour à la ligne
+            if (mStart == mEnd)
+                return false;
+            newline = mBuffer.data() + mEnd;
+        }
+
+        const char* line = mBuffer.data() + mStart;
+        size_t length = newline - line;
+        mStart = (newline - mBuffer.data()) + (newline < mBuffer.data() + mEnd ? 1 : 0);
+        mLineNumber++;
+
+        // Retire le '\r' et les blancs de fin de ligne
+        while (length > 0 && (line[length - 1] == '\r' || line[length - 1] == ' ' ||
+                              line[length - 1] == '\t'))
+            length--;
+
+        if (length == 0 || line[0] == '#')
+            continue;
+
+        // Annotation après la grille (ex. sortie de "sudoku-cli grade") :
+        // ignorée
+        if (length > CELL_COUNT && (line[CELL_COUNT] == ' ' || line[CELL_COUNT] == '\t'))
+            length = CELL_COUNT;
+
+        if (length != CELL_COUNT || !ParseDigits(line, cells) || !HasValidGivens(cells))
+        {
+            mInvalidCount++;
+            continue;
+        }
+
+        return true;
+    }
+}
+
+// ============================================================================
+// Lit la prochaine grille dans une SudokuGrid
+// ============================================================================
+bool PuzzleReader::Next(SudokuGrid& grid)
+{
+    int cells[CELL_COUNT];
+    if (!Next(cells))
+        return false;
+
+    grid.LoadPuzzle(cells);
+    return true;
+}
+
+// ============================================================================
+// Compteurs
+// ============================================================================
+uint64_t PuzzleReader::GetLineNumber() const
+{
+    return mLineNumber;
+}
+
+uint64_t PuzzleReader::GetInvalidCount() const
+{
+    return mInvalidCount;
+}
+
+uint64_t PuzzleReader::GetBytesRead() const
+{
+    return mBytesRead;
+}
+
+// ============================================================================
+// Convertit 81 caractères en chiffres
+// ============================================================================
+bool PuzzleReader::ParseDigits(const char* text, int* cells)
+{
+    int i = 0;
+
+#if PUZZLE_TEXT_SSE2
+    // 16 caractères à la fois : '.' devient '0', puis soustraction de '0'.
+    // Un caractère valide donne 0 à 9 (comparaison non signée).
+    const __m128i dot = _mm_set1_epi8('.');
+    const __m128i zero = _mm_set1_epi8('0');
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i none = _mm_setzero_si128();
+
+    for (; i + 16 <= CELL_COUNT; i += 16)
+    {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+        __m128i isDot = _mm_cmpeq_epi8(chars, dot);
+        chars = _mm_or_si128(_mm_andnot_si128(isDot, chars), _mm_and_si128(isDot, zero));
+
+        __m128i digits = _mm_sub_epi8(chars, zero);
+        __m128i inRange = _mm_cmpeq_epi8(_mm_max_epu8(digits, nine), nine);
+        if (_mm_movemask_epi8(inRange) != 0xFFFF)
+            return false;
+
+        // Élargit les octets en entiers 32 bits
+        __m128i low = _mm_unpacklo_epi8(digits, none);
+        __m128i high = _mm_unpackhi_epi8(digits, none);
+        __m128i* out = reinterpret_cast<__m128i*>(cells + i);
+        _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(low, none));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low, none));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, none));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, none));
+    }
+#endif
+
+    // Reste (ou tout, sans SSE2)
+    for (; i < CELL_COUNT; i++)
+    {
+        char c = text[i];
+        if (c >= '0' && c <= '9')
+            cells[i] = c - '0';
+        else if (c == '.')
+            cells[i] = 0;
+        else
+            return false;
+    }
+
+    return true;
+}
+
+// ============================================================================
+// Vérifie que les indices ne se contredisent pas
+// ============================================================================
+bool PuzzleReader::HasValidGivens(const int* cells)
+{
+    // Un bit par chiffre, nul pour une case vide (sans branchement : les
+    // cases vides sont imprévisibles)
+    unsigned int bits[CELL_COUNT];
+    for (int i = 0; i < CELL_COUNT; i++)
+        bits[i] = (1u << cells[i]) >> 1;
+
+    // Dans chaque ligne, colonne et bloc, la somme des bits égale leur OU
+    // si et seulement si aucun chiffre n'est répété (sinon une retenue
+    // apparaît). Les 27 unités sont indépendantes : pas de chaîne de
+    // dépendances d'une case à l'autre.
+    unsigned int conflicts = 0;
+    for (int unit = 0; unit < GRID_SIZE; unit++)
+    {
+        unsigned int rowSum = 0, rowOr = 0;
+        unsigned int colSum = 0, colOr = 0;
+        unsigned int boxSum = 0, boxOr = 0;
+        int boxStart = (unit / 3) * 27 + (unit % 3) * 3;
+
+        for (int k = 0; k < GRID_SIZE; k++)
+        {
+            unsigned int rowBit = bits[unit * GRID_SIZE + k];
+            unsigned int colBit = bits[k * GRID_SIZE + unit];
+            unsigned int boxBit = bits[boxStart + (k / 3) * GRID_SIZE + k % 3];
+
+            rowSum += rowBit;
+            rowOr |= rowBit;
+            colSum += colBit;
+            colOr |= colBit;
+            boxSum += boxBit;
+            boxOr |= boxBit;
+        }
+
+        conflicts |= (rowSum ^ rowOr) | (colSum ^ colOr) | (boxSum ^ boxOr);
+    }
+
+    return conflicts == 0;
+}
+
+// ============================================================================
+// Constructeur
+// ============================================================================
+PuzzleWriter::PuzzleWriter() : mFile(nullptr), mOwnsFile(false), mUsed(0), mFailed(false)
+{
+}
+
+// ============================================================================
+// Destructeur
+// ============================================================================
+PuzzleWriter::~PuzzleWriter()
+{
+    Close();
+}
+
+// ============================================================================
+// Ouvre un fichier en écriture ("-" = sortie standard)
+// ============================================================================
+bool PuzzleWriter::Open(const std::string& path)
+{
+    Close();
+
+    if (path == "-")
+    {
+        mFile = stdout;
+        mOwnsFile = false;
+    }
+    else
+    {
+        mFile = fopen(path.c_str(), "wb");
+        mOwnsFile = true;
+        if (!mFile)
+            return false;
+        setvbuf(mFile, nullptr, _IONBF, 0);
+    }
+
+    mBuffer.resize(PUZZLE_TEXT_CHUNK_SIZE);
+    mUsed = 0;
+    mFailed = false;
+    return true;
+}
+
+// ============================================================================
+// Écrit le tampon dans le fichier
+// ============================================================================
+bool PuzzleWriter::Flush()
+{
+    if (mUsed > 0 && fwrite(mBuffer.data(), 1, mUsed, mFile) != mUsed)
+        mFailed = true;
+    mUsed = 0;
+    return !mFailed;
+}
+
+// ============================================================================
+// Vide le tampon et ferme le fichier
+// ============================================================================
+bool PuzzleWriter::Close()
+{
+    if (!mFile)
+        return !mFailed;
+
+    Flush();
+    if (mOwnsFile)
+    {
+        if (fclose(mFile) != 0)
+            mFailed = true;
+    }
+    else
+    {
+        fflush(mFile);
+    }
+
+    mFile = nullptr;
+    return !mFailed;
+}
+
+// ============================================================================
+// Ajoute une grille
+// ============================================================================
+bool PuzzleWriter::Write(const int* cells)
+{
+    if (!mFile)
+        return false;
+
+    if (mBuffer.size() - mUsed < CELL_COUNT + 1 && !Flush())
+        return false;
+
+    // Table plutôt que test : les cases vides sont imprévisibles
+    static const char CHARACTERS[] = ".123456789";
+
+    char* line = mBuffer.data() + mUsed;
+    for (int i = 0; i < CELL_COUNT; i++)
+        line[i] = CHARACTERS[cells[i]];
+    line[CELL_COUNT] = '\n';
+    mUsed += CELL_COUNT + 1;
+    return true;
+}
+
+// ============================================================================
+// Ajoute une grille suivie d'une annotation sur la même ligne
+// ============================================================================
+bool PuzzleWriter::Write(const int* cells, const char* annotation)
+{
+    if (!Write(cells))
+        return false;
+
+    // Remplace le retour à la ligne par " annotation\n"
+    mUsed--;
+    size_t length = strlen(annotation);
+    if (mBuffer.size() - mUsed < length + 2 && !Flush())
+        return false;
+
+    char* text = mBuffer.data() + mUsed;
+    text[0] = ' ';
+    memcpy(text + 1, annotation, length);
+    text[length + 1] = '\n';
+    mUsed += length + 2;
+    return true;
+}
+
+// ============================================================================
+// Ajoute le contenu d'une SudokuGrid (cases initiales et chiffres du joueur)
+// ============================================================================
+bool PuzzleWriter::Write(const SudokuGrid& grid)
+{
+    int cells[CELL_COUNT];
+    for (int i = 0; i < CELL_COUNT; i++)
+        cells[i] = grid.GetCell(i / GRID_SIZE, i % GRID_SIZE);
+    return Write(cells);
+}
@@ -0,0 +1,241 @@
+// ============================================================================
+// SessionStore.cpp
+// Implémentation de la sauvegarde de la partie en cours
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "../include/SessionStore.h"
+#include "../include/Log.h"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(SessionFileHeader) == 24, "En-tete de session inattendu");
+static_assert(sizeof(SessionRecord) == 96, "Enregistrement de session inattendu");
+
+// ============================================================================
+// Somme de contrôle FNV-1a (32 bits)
+// ============================================================================
+static uint32_t Checksum(const void* data, size_t size)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// ============================================================================
+// Constructeur : démarre le thread d'écriture
+// ============================================================================
+SessionStore::SessionStore(const std::string& path)
+    : mPath(path), mHasPending(false), mRemovePending(false), mStopping(false)
+{
+    mWriterThread = std::thread(&SessionStore::WriterLoop, this);
+}
+
+// ============================================================================
+// Destructeur : écrit la dernière demande puis arrête le thread
+// ============================================================================
+SessionStore::~SessionStore()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mCondition.notify_one();
+
+    if (mWriterThread.joinable())
+        mWriterThread.join();
+}
+
+// ============================================================================
+// Chemin du fichier de session
+// ============================================================================
+const std::string& SessionStore::GetPath() const
+{
+    return mPath;
+}
+
+// ============================================================================
+// Demande l'écriture d'un instantané
+// ============================================================================
+void SessionStore::Save(const SessionSnapshot& snapshot)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mPending = snapshot;
+        mHasPending = true;
+        mRemovePending = false;
+    }
+    mCondition.notify_one();
+}
+
+// ============================================================================
+// Demande la suppression du fichier
+// ============================================================================
+void SessionStore::Discard()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mHasPending = false;
+        mRemovePending = true;
+    }
+    mCondition.notify_one();
+}
+
+// ============================================================================
+// Boucle du thread d'écriture
+// ============================================================================
+void SessionStore::WriterLoop()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    for (;;)
+    {
+        mCondition.wait(lock, [this]() { return mHasPending || mRemovePending || mStopping; });
+
+        if (mHasPending)
+        {
+            // Copie locale : le jeu peut redemander pendant l'écriture
+            SessionSnapshot snapshot = mPending;
+            mHasPending = false;
+
+            lock.unlock();
+            Write(mPath, snapshot);
+            lock.lock();
+        }
+        else if (mRemovePending)
+        {
+            mRemovePending = false;
+
+            lock.unlock();
+            std::error_code error;
+            std::filesystem::remove(mPath, error);
+            lock.lock();
+        }
+        else if (mStopping)
+        {
+            return;
+        }
+    }
+}
+
+// ============================================================================
+// Écrit un instantané (fichier temporaire puis renommage)
+// ============================================================================
+bool SessionStore::Write(const std::string& path, const SessionSnapshot& snapshot)
+{
+    SessionRecord record;
+    memset(&record, 0, sizeof(record));
+    for (int i = 0; i < CELL_COUNT; i++)
+    {
+        record.cells[i] = static_cast<uint8_t>(snapshot.cells[i]) |
+                          (snapshot.initial[i] ? SESSION_INITIAL_FLAG : 0);
+    }
+    record.selectedRow = static_cast<int8_t>(snapshot.selectedRow);
+    record.selectedCol = static_cast<int8_t>(snapshot.selectedCol);
+    record.elapsedMs = snapshot.elapsedMs;
+
+    SessionFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SESSION_MAGIC, sizeof(header.magic));
+    header.version = SESSION_VERSION;
+    header.recordSize = sizeof(record);
+    header.checksum = Checksum(&record, sizeof(record));
+
+    std::string temporary = path + ".tmp";
+    FILE* file = fopen(temporary.c_str(), "wb");
+    if (!file)
+    {
+        LOG_WARN("Impossible d'ecrire la session: %s", temporary.c_str());
+        return false;
+    }
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(&record, sizeof(record), 1, file) == 1 &&
+              fflush(file) == 0;
+
+#if !defined(_WIN32)
+    // Les données doivent être sur le disque avant le renommage
+    ok = ok && fsync(fileno(file)) == 0;
+#endif
+
+    ok = (fclose(file) == 0) && ok;
+
+    // std::filesystem::rename remplace aussi la cible sous Windows
+    std::error_code error;
+    if (ok)
+        std::filesystem::rename(temporary, path, error);
+
+    if (!ok || error)
+    {
+        LOG_WARN("Echec de l'ecriture de la session: %s", path.c_str());
+        std::filesystem::remove(temporary, error);
+        return false;
+    }
+
+    return true;
+}
+
+// ============================================================================
+// Lit et vérifie un instantané
+// ============================================================================
+bool SessionStore::Read(const std::string& path, SessionSnapshot& snapshot)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file)
+        return false;
+
+    SessionFileHeader header;
+    SessionRecord record;
+    bool ok = fread(&header, sizeof(header), 1, file) == 1 &&
+              memcmp(header.magic, SESSION_MAGIC, sizeof(header.magic)) == 0 &&
+              header.version == SESSION_VERSION &&
+              header.recordSize == sizeof(record) &&
+              fread(&record, sizeof(record), 1, file) == 1 &&
+              header.checksum == Checksum(&record, sizeof(record));
+    fclose(file);
+
+    // Sélection : aucune, ou une case de la grille
+    ok = ok && ((record.selectedRow == -1 && record.selectedCol == -1) ||
+                (record.selectedRow >= 0 && record.selectedRow < GRID_SIZE &&
+                 record.selectedCol >= 0 && record.selectedCol < GRID_SIZE));
+
+    for (int i = 0; i < CELL_COUNT && ok; i++)
+    {
+        int value = record.cells[i] & 0x0F;
+        bool initial = (record.cells[i] & SESSION_INITIAL_FLAG) != 0;
+
+        // Chiffre de 0 à 9, case initiale jamais vide, aucun bit inconnu
+        if (value > 9 || (initial && value == 0) ||
+            (record.cells[i] & ~(SESSION_INITIAL_FLAG | 0x0F)) != 0)
+        {
+            ok = false;
+            break;
+        }
+
+        snapshot.cells[i] = value;
+        snapshot.initial[i] = initial;
+    }
+
+    if (!ok)
+    {
+        LOG_WARN("Session ignoree (version ou contenu invalide): %s", path.c_str());
+        return false;
+    }
+
+    snapshot.selectedRow = record.selectedRow;
+    snapshot.selectedCol = record.selectedCol;
+    snapshot.elapsedMs = record.elapsedMs;
+    return true;
+}
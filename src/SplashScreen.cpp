@@ -6,26 +6,54 @@
 // ============================================================================
 
 #include "../include/SplashScreen.h"
-#include "../include/Utils.h"
+#include "../include/Display.h"
 #include <cmath>
 
 // ============================================================================
 // Constructeur
 // ============================================================================
 SplashScreen::SplashScreen(SDL_Renderer* renderer) 
-    : mRenderer(renderer), mStartTime(0), mIsFinished(false)
+    : mRenderer(renderer), mStartTime(0), mIsFinished(false),
+      mTitleTexture(nullptr), mSubtitleTexture(nullptr)
 {
 }
 
+// ============================================================================
+// Destructeur
+// ============================================================================
+SplashScreen::~SplashScreen()
+{
+    if (mTitleTexture)
+        SDL_DestroyTexture(mTitleTexture);
+    
+    if (mSubtitleTexture)
+        SDL_DestroyTexture(mSubtitleTexture);
+}
+
 // ============================================================================
 // Démarre l'animation
 // ============================================================================
 void SplashScreen::Start()
 {
+    // Pré-rendu unique : chaque frame ne fait plus que deux copies de texture
+    if (!mTitleTexture)
+        mTitleTexture = CreateTextTexture("JUST MAX IT", true);
+    
+    if (!mSubtitleTexture)
+        mSubtitleTexture = CreateTextTexture("Everyday", false);
+    
     mStartTime = SDL_GetTicks();
     mIsFinished = false;
 }
 
+// ============================================================================
+// Termine immédiatement l'animation
+// ============================================================================
+void SplashScreen::Skip()
+{
+    mIsFinished = true;
+}
+
 // ============================================================================
 // Calcule l'opacité en fonction du temps (fade in/hold/fade out)
 // ============================================================================
@@ -223,6 +251,50 @@ void SplashScreen::DrawText(const std::string& text, int y, int alpha, bool larg
     }
 }
 
+// ============================================================================
+// Pré-rend un texte dans une texture transparente
+// ============================================================================
+SDL_Texture* SplashScreen::CreateTextTexture(const std::string& text, bool large)
+{
+    // Hauteur : lettre + épaisseur des traits (voir DrawText)
+    int height = large ? 50 + 5 + 1 : 30 + 3 + 1;
+    
+    SDL_Texture* texture = SDL_CreateTexture(mRenderer, SDL_PIXELFORMAT_RGBA8888,
+                                             SDL_TEXTUREACCESS_TARGET,
+                                             WINDOW_WIDTH, height);
+    if (!texture)
+        return nullptr; // Pas de cible de rendu : dessin direct à chaque frame
+    
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    
+    if (!SDL_SetRenderTarget(mRenderer, texture))
+    {
+        SDL_DestroyTexture(texture);
+        return nullptr;
+    }
+    
+    SDL_SetRenderDrawColor(mRenderer, 0, 0, 0, 0);
+    SDL_RenderClear(mRenderer);
+    DrawText(text, 0, 255, large);
+    SDL_SetRenderTarget(mRenderer, nullptr);
+    
+    return texture;
+}
+
+// ============================================================================
+// Dessine une texture de texte avec l'opacité demandée
+// ============================================================================
+void SplashScreen::DrawTextTexture(SDL_Texture* texture, int y, int alpha)
+{
+    float width = 0.0f;
+    float height = 0.0f;
+    SDL_GetTextureSize(texture, &width, &height);
+    
+    SDL_SetTextureAlphaMod(texture, (Uint8)alpha);
+    SDL_FRect destination = {0.0f, (float)y, width, height};
+    SDL_RenderTexture(mRenderer, texture, nullptr, &destination);
+}
+
 // ============================================================================
 // Dessine le logo complet "JUST MAX IT" + "Everyday"
 // ============================================================================
@@ -252,12 +324,18 @@ void SplashScreen::DrawLogo(int alpha)
     }
     
     // Dessine "JUST MAX IT"
-    DrawText("JUST MAX IT", WINDOW_HEIGHT / 2 - 60, alpha1, true);
+    if (mTitleTexture)
+        DrawTextTexture(mTitleTexture, WINDOW_HEIGHT / 2 - 60, alpha1);
+    else
+        DrawText("JUST MAX IT", WINDOW_HEIGHT / 2 - 60, alpha1, true);
     
     // Dessine "Everyday"
     if (alpha2 > 0)
     {
-        DrawText("Everyday", WINDOW_HEIGHT / 2 + 40, alpha2, false);
+        if (mSubtitleTexture)
+            DrawTextTexture(mSubtitleTexture, WINDOW_HEIGHT / 2 + 40, alpha2);
+        else
+            DrawText("Everyday", WINDOW_HEIGHT / 2 + 40, alpha2, false);
     }
     
     // Effet de lueur
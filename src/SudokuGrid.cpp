@@ -6,9 +6,13 @@
 // ============================================================================
 
 #include "../include/SudokuGrid.h"
+#include "../include/PuzzleGenerator.h"
+#include "../include/Trace.h"
 #include <cstdlib>
 #include <ctime>
 
+PuzzleSource* SudokuGrid::sPuzzleSource = nullptr;
+
 // ============================================================================
 // Constructeur
 // ============================================================================
@@ -27,14 +31,87 @@ SudokuGrid::SudokuGrid()
 // ============================================================================
 void SudokuGrid::Initialize()
 {
+    TRACE_SCOPE("SudokuGrid::Initialize", "grid");
+    
+    // Grille fournie par la source (base de grilles...)
+    int cells[CELL_COUNT];
+    if (sPuzzleSource && sPuzzleSource->NextPuzzle(cells))
+    {
+        LoadPuzzle(cells);
+        return;
+    }
+    
     Clear();        // Vide d'abord la grille
     GenerateGrid(); // Génère une nouvelle grille
 }
 
+// ============================================================================
+// Source de grilles utilisée par Initialize
+// ============================================================================
+void SudokuGrid::SetPuzzleSource(PuzzleSource* source)
+{
+    sPuzzleSource = source;
+}
+
+// ============================================================================
+// Charge une grille : chaque chiffre devient une case initiale
+// ============================================================================
+void SudokuGrid::LoadPuzzle(const int* cells)
+{
+    for (int i = 0; i < GRID_SIZE; i++)
+    {
+        for (int j = 0; j < GRID_SIZE; j++)
+        {
+            int value = cells[i * GRID_SIZE + j];
+            mGrid[i][j] = value;
+            mInitialGrid[i][j] = (value != 0);
+        }
+    }
+}
+
+// ============================================================================
+// Charge la grille n° "number"
+// ============================================================================
+void SudokuGrid::LoadNumbered(uint64_t number)
+{
+    TRACE_SCOPE("SudokuGrid::LoadNumbered", "grid");
+    
+    int cells[CELL_COUNT];
+    PuzzleGenerator::GenerateNumbered(number, cells);
+    LoadPuzzle(cells);
+}
+
+// ============================================================================
+// Charge la grille du jour "day"
+// ============================================================================
+void SudokuGrid::LoadDaily(uint64_t day)
+{
+    TRACE_SCOPE("SudokuGrid::LoadDaily", "grid");
+    
+    int cells[CELL_COUNT];
+    PuzzleGenerator::GenerateDaily(day, cells);
+    LoadPuzzle(cells);
+}
+
+// ============================================================================
+// Restaure une partie en cours
+// ============================================================================
+void SudokuGrid::Restore(const int* cells, const bool* initial)
+{
+    for (int i = 0; i < GRID_SIZE; i++)
+    {
+        for (int j = 0; j < GRID_SIZE; j++)
+        {
+            mGrid[i][j] = cells[i * GRID_SIZE + j];
+            mInitialGrid[i][j] = initial[i * GRID_SIZE + j];
+        }
+    }
+}
+
 // ============================================================================
 // Vérifie si un placement est valide
 // ============================================================================
-bool SudokuGrid::IsValidPlacement(int row, int col, int num)
+bool SudokuGrid::IsValidPlacement(int row, int col, int num) const
 {
     // Vérifie la ligne
     for (int x = 0; x < GRID_SIZE; x++)
@@ -74,6 +151,8 @@ bool SudokuGrid::IsValidPlacement(int row, int col, int num)
 // ============================================================================
 void SudokuGrid::GenerateGrid()
 {
+    TRACE_SCOPE("SudokuGrid::GenerateGrid", "grid");
+    
     int placed = 0;
     int attempts = 0;
     const int MAX_ATTEMPTS = 1000;
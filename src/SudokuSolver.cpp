@@ -0,0 +1,212 @@
+// ============================================================================
+// SudokuSolver.cpp
+// Implémentation du solveur
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "../include/SudokuSolver.h"
+#include <cstring>
+
+// Tous les chiffres possibles (bits 0 à 8)
+static const unsigned short ALL_DIGITS = 0x1FF;
+
+// ============================================================================
+// Bloc 3x3 d'une case
+// ============================================================================
+static inline int BoxOf(int row, int col)
+{
+    return (row / 3) * 3 + col / 3;
+}
+
+// ============================================================================
+// Tables de la recherche : ligne, colonne et bloc de chaque case, nombre de
+// chiffres d'un masque (sans division ni popcount logiciel par nœud quand
+// la cible n'a pas d'instruction popcount)
+// ============================================================================
+struct SearchTables
+{
+    unsigned char row[CELL_COUNT];
+    unsigned char col[CELL_COUNT];
+    unsigned char box[CELL_COUNT];
+    unsigned char bitCount[ALL_DIGITS + 1];
+
+    SearchTables()
+    {
+        for (int i = 0; i < CELL_COUNT; i++)
+        {
+            row[i] = static_cast<unsigned char>(i / GRID_SIZE);
+            col[i] = static_cast<unsigned char>(i % GRID_SIZE);
+            box[i] = static_cast<unsigned char>(BoxOf(row[i], col[i]));
+        }
+        for (int mask = 0; mask <= ALL_DIGITS; mask++)
+            bitCount[mask] = static_cast<unsigned char>(__builtin_popcount(mask));
+    }
+};
+
+static const SearchTables TABLES;
+
+// ============================================================================
+// Constructeur
+// ============================================================================
+SudokuSolver::SudokuSolver()
+    : mEmptyCount(0), mSolutionCount(0), mLimit(1), mNodes(0)
+{
+    memset(mRows, 0, sizeof(mRows));
+    memset(mCols, 0, sizeof(mCols));
+    memset(mBoxes, 0, sizeof(mBoxes));
+    memset(mCells, 0, sizeof(mCells));
+    memset(mSolution, 0, sizeof(mSolution));
+}
+
+// ============================================================================
+// Charge une grille et vérifie que les indices sont compatibles
+// ============================================================================
+bool SudokuSolver::Load(const int* cells)
+{
+    memset(mRows, 0, sizeof(mRows));
+    memset(mCols, 0, sizeof(mCols));
+    memset(mBoxes, 0, sizeof(mBoxes));
+    mEmptyCount = 0;
+    mSolutionCount = 0;
+    mNodes = 0;
+
+    for (int i = 0; i < CELL_COUNT; i++)
+    {
+        int value = cells[i];
+        mCells[i] = value;
+
+        if (value == 0)
+        {
+            mEmpty[mEmptyCount++] = i;
+            continue;
+        }
+
+        if (value < 1 || value > 9)
+            return false;
+
+        int row = i / GRID_SIZE;
+        int col = i % GRID_SIZE;
+        int box = BoxOf(row, col);
+        unsigned short bit = 1 << (value - 1);
+
+        // Chiffre déjà présent dans la ligne, la colonne ou le bloc
+        if ((mRows[row] | mCols[col] | mBoxes[box]) & bit)
+            return false;
+
+        mRows[row] |= bit;
+        mCols[col] |= bit;
+        mBoxes[box] |= bit;
+    }
+
+    return true;
+}
+
+// ============================================================================
+// Recherche récursive
+// ============================================================================
+void SudokuSolver::Search(int depth)
+{
+    mNodes++;
+
+    if (depth == mEmptyCount)
+    {
+        if (mSolutionCount == 0)
+            memcpy(mSolution, mCells, sizeof(mSolution));
+        mSolutionCount++;
+        return;
+    }
+
+    // Case la plus contrainte (moins de candidats) parmi les cases restantes
+    int best = depth;
+    unsigned short bestMask = 0;
+    int bestCount = 10;
+
+    for (int i = depth; i < mEmptyCount; i++)
+    {
+        int cell = mEmpty[i];
+        unsigned short mask = ALL_DIGITS & ~(mRows[TABLES.row[cell]] | mCols[TABLES.col[cell]] |
+                                             mBoxes[TABLES.box[cell]]);
+        int count = TABLES.bitCount[mask];
+
+        if (count < bestCount)
+        {
+            best = i;
+            bestMask = mask;
+            bestCount = count;
+
+            // Impasse, ou choix forcé : inutile de chercher plus loin
+            if (count <= 1)
+                break;
+        }
+    }
+
+    if (bestCount == 0)
+        return;
+
+    int cell = mEmpty[best];
+    mEmpty[best] = mEmpty[depth];
+    mEmpty[depth] = cell;
+
+    int row = TABLES.row[cell];
+    int col = TABLES.col[cell];
+    int box = TABLES.box[cell];
+
+    while (bestMask != 0 && mSolutionCount < mLimit)
+    {
+        unsigned short bit = bestMask & -bestMask;
+        bestMask ^= bit;
+
+        mRows[row] |= bit;
+        mCols[col] |= bit;
+        mBoxes[box] |= bit;
+        mCells[cell] = __builtin_ctz(bit) + 1;
+
+        Search(depth + 1);
+
+        mRows[row] ^= bit;
+        mCols[col] ^= bit;
+        mBoxes[box] ^= bit;
+    }
+
+    mCells[cell] = 0;
+}
+
+// ============================================================================
+// Résout la grille sur place
+// ============================================================================
+bool SudokuSolver::Solve(int* cells)
+{
+    if (!Load(cells))
+        return false;
+
+    mLimit = 1;
+    Search(0);
+
+    if (mSolutionCount == 0)
+        return false;
+
+    memcpy(cells, mSolution, sizeof(mSolution));
+    return true;
+}
+
+// ============================================================================
+// Compte les solutions (au plus "limit")
+// ============================================================================
+int SudokuSolver::CountSolutions(const int* cells, int limit)
+{
+    if (!Load(cells))
+        return 0;
+
+    mLimit = limit;
+    Search(0);
+    return mSolutionCount;
+}
+
+// ============================================================================
+// Nœuds visités par la dernière recherche
+// ============================================================================
+long long SudokuSolver::GetNodeCount() const
+{
+    return mNodes;
+}
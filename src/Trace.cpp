@@ -0,0 +1,217 @@
+// ============================================================================
+// Trace.cpp
+// Implémentation de l'enregistreur de traces
+// Auteur: [Vivien Yann Nka]
+// Date: Janvier 2026
+// ============================================================================
+
+#include "../include/Trace.h"
+#include "../include/Log.h"
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+std::atomic<bool> TraceRecorder::sActive(false);
+
+// ============================================================================
+// Événement en mémoire (écrit plus tard par le thread de vidage)
+// ============================================================================
+struct TraceEvent
+{
+    const char* name;
+    const char* category;
+    long long startNs;      // Depuis le début de la session
+    long long durationNs;   // -1 pour un événement ponctuel
+    unsigned int threadId;
+};
+
+// Nombre d'événements par bloc avant transfert au thread d'écriture
+static const size_t TRACE_CHUNK_SIZE = 4096;
+
+static std::mutex sMutex;                              // Protège les blocs
+static std::condition_variable sWakeup;
+static std::vector<TraceEvent> sCurrentChunk;          // Bloc en remplissage
+static std::deque<std::vector<TraceEvent>> sPending;   // Blocs à écrire
+static bool sStopRequested = false;
+static std::thread sFlushThread;
+static FILE* sFile = nullptr;
+static bool sFirstEvent = true;
+static TraceRecorder::Clock::time_point sOrigin;
+static std::atomic<unsigned int> sNextThreadId(1);
+
+// ============================================================================
+// Identifiant court du thread appelant
+// ============================================================================
+static unsigned int CurrentThreadId()
+{
+    thread_local unsigned int id = sNextThreadId.fetch_add(1);
+    return id;
+}
+
+// ============================================================================
+// Écrit un bloc d'événements dans le fichier (thread d'écriture)
+// ============================================================================
+static void WriteChunk(const std::vector<TraceEvent>& chunk)
+{
+    for (const TraceEvent& event : chunk)
+    {
+        fputs(sFirstEvent ? "\n" : ",\n", sFile);
+        sFirstEvent = false;
+
+        double ts = event.startNs / 1000.0; // Microsecondes
+
+        if (event.durationNs >= 0)
+        {
+            fprintf(sFile,
+                    "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,"
+                    "\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                    event.name, event.category, ts, event.durationNs / 1000.0,
+                    event.threadId);
+        }
+        else
+        {
+            fprintf(sFile,
+                    "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"i\",\"s\":\"t\","
+                    "\"ts\":%.3f,\"pid\":1,\"tid\":%u}",
+                    event.name, event.category, ts, event.threadId);
+        }
+    }
+}
+
+// ============================================================================
+// Boucle du thread d'écriture
+// ============================================================================
+static void FlushLoop()
+{
+    std::unique_lock<std::mutex> lock(sMutex);
+
+    for (;;)
+    {
+        sWakeup.wait(lock, [] { return sStopRequested || !sPending.empty(); });
+
+        while (!sPending.empty())
+        {
+            std::vector<TraceEvent> chunk;
+            chunk.swap(sPending.front());
+            sPending.pop_front();
+
+            // Écrit sans tenir le verrou : le jeu continue d'enregistrer
+            lock.unlock();
+            WriteChunk(chunk);
+            lock.lock();
+        }
+
+        if (sStopRequested)
+            break;
+    }
+}
+
+// ============================================================================
+// Ajoute un événement au bloc courant
+// ============================================================================
+static void Push(const TraceEvent& event)
+{
+    std::lock_guard<std::mutex> lock(sMutex);
+
+    sCurrentChunk.push_back(event);
+
+    if (sCurrentChunk.size() >= TRACE_CHUNK_SIZE)
+    {
+        sPending.push_back(std::move(sCurrentChunk));
+        sCurrentChunk = std::vector<TraceEvent>();
+        sCurrentChunk.reserve(TRACE_CHUNK_SIZE);
+        sWakeup.notify_one();
+    }
+}
+
+// ============================================================================
+// Démarre une session
+// ============================================================================
+bool TraceRecorder::Start(const std::string& path)
+{
+    if (IsActive())
+        return true;
+
+    sFile = fopen(path.c_str(), "w");
+    if (!sFile)
+    {
+        LOG_ERROR("Impossible d'ouvrir le fichier de trace: %s", path.c_str());
+        return false;
+    }
+
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", sFile);
+    sFirstEvent = true;
+    sStopRequested = false;
+    sOrigin = Clock::now();
+    sCurrentChunk.clear();
+    sCurrentChunk.reserve(TRACE_CHUNK_SIZE);
+
+    sFlushThread = std::thread(FlushLoop);
+    sActive.store(true);
+
+    LOG_INFO("Enregistrement de la trace dans %s", path.c_str());
+    return true;
+}
+
+// ============================================================================
+// Termine la session
+// ============================================================================
+void TraceRecorder::Stop()
+{
+    if (!sActive.exchange(false))
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(sMutex);
+        if (!sCurrentChunk.empty())
+            sPending.push_back(std::move(sCurrentChunk));
+        sCurrentChunk = std::vector<TraceEvent>();
+        sStopRequested = true;
+    }
+    sWakeup.notify_one();
+
+    if (sFlushThread.joinable())
+        sFlushThread.join();
+
+    fputs("\n]}\n", sFile);
+    fclose(sFile);
+    sFile = nullptr;
+}
+
+// ============================================================================
+// Ajoute un intervalle terminé
+// ============================================================================
+void TraceRecorder::AddComplete(const char* name, const char* category,
+                                Clock::time_point start, Clock::time_point end)
+{
+    if (!IsActive())
+        return;
+
+    TraceEvent event;
+    event.name = name;
+    event.category = category;
+    event.startNs = std::chrono::duration_cast<std::chrono::nanoseconds>(start - sOrigin).count();
+    event.durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    event.threadId = CurrentThreadId();
+    Push(event);
+}
+
+// ============================================================================
+// Ajoute un événement ponctuel
+// ============================================================================
+void TraceRecorder::AddInstant(const char* name, const char* category)
+{
+    if (!IsActive())
+        return;
+
+    TraceEvent event;
+    event.name = name;
+    event.category = category;
+    event.startNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - sOrigin).count();
+    event.durationNs = -1;
+    event.threadId = CurrentThreadId();
+    Push(event);
+}
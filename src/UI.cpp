@@ -7,9 +7,15 @@
 
 #include "../include/UI.h"
 #include "../include/SudokuGrid.h"
+#include "../include/Profiler.h"
 #include "imgui.h"
 #include "imgui_impl_sdl3.h"
 #include "imgui_impl_sdlrenderer3.h"
+#include <fstream>
+#include <sstream>
+
+// Fichier de configuration des fenêtres ImGui
+static const char* IMGUI_INI_FILE = "imgui.ini";
 
 // ============================================================================
 // Constructeur
@@ -25,6 +31,20 @@ UI::~UI()
 {
 }
 
+// ============================================================================
+// Lance la lecture de imgui.ini en arrière-plan
+// ============================================================================
+void UI::StartLoadingSettings()
+{
+    mSettingsLoad = std::async(std::launch::async, []() {
+        std::ifstream file(IMGUI_INI_FILE, std::ios::binary);
+        std::ostringstream contents;
+        if (file)
+            contents << file.rdbuf();
+        return contents.str();
+    });
+}
+
 // ============================================================================
 // Initialise ImGui
 // ============================================================================
@@ -34,9 +54,18 @@ void UI::Initialize(SDL_Window* window, SDL_Renderer* renderer)
     IMGUI_CHECKVERSION();
     ImGui::CreateContext();
     ImGuiIO& io = ImGui::GetIO();
-    (void)io;
+    io.IniFilename = IMGUI_INI_FILE;
     io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard; // Navigation au clavier
     
+    // Réglages lus en arrière-plan : ImGui ne relira pas le disque au
+    // premier NewFrame (il sauvegarde toujours dans imgui.ini)
+    if (mSettingsLoad.valid())
+    {
+        std::string settings = mSettingsLoad.get();
+        if (!settings.empty())
+            ImGui::LoadIniSettingsFromMemory(settings.c_str(), settings.size());
+    }
+    
     // Style sombre par défaut
     ImGui::StyleColorsDark();
     
@@ -64,6 +93,10 @@ void UI::Initialize(SDL_Window* window, SDL_Renderer* renderer)
 // ============================================================================
 void UI::Shutdown()
 {
+    // Rien à fermer si le démarrage a échoué avant Initialize
+    if (!ImGui::GetCurrentContext())
+        return;
+    
     ImGui_ImplSDLRenderer3_Shutdown();
     ImGui_ImplSDL3_Shutdown();
     ImGui::DestroyContext();
@@ -89,10 +122,22 @@ void UI::Render()
 }
 
 // ============================================================================
-// Dessine le menu principal
+// Frame ImGui vide : construit l'atlas de polices et crée sa texture
 // ============================================================================
-void UI::DrawMainMenu(SudokuGrid* grid)
+void UI::WarmUp()
 {
+    NewFrame();
+    Render();
+}
+
+// ============================================================================
+// Dessine le menu principal. Les boutons ne touchent pas à la grille : Game
+// exécute l'action retournée.
+// ============================================================================
+MenuAction UI::DrawMainMenu(bool gridReady)
+{
+    MenuAction action = MenuAction::None;
+    
     // Position et taille de la fenêtre
     ImGui::SetNextWindowPos(ImVec2(550.0f, 80.0f), ImGuiCond_FirstUseEver);
     ImGui::SetNextWindowSize(ImVec2(230.0f, 420.0f), ImGuiCond_FirstUseEver);
@@ -109,12 +154,15 @@ void UI::DrawMainMenu(SudokuGrid* grid)
     ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.6f, 1.0f), "Controles");
     ImGui::Spacing();
     
+    // Génération de démarrage en cours (thread) : pas de seconde génération
+    // concurrente sur le thread principal
+    ImGui::BeginDisabled(!gridReady);
+    
     // Bouton Nouvelle Grille
     if (ImGui::Button("Nouvelle Grille", ImVec2(-1.0f, 40.0f)))
     {
-        grid->Initialize();
         mShowWinMessage = false;
-        ShowMessage("Nouvelle grille !");
+        action = MenuAction::NewGrid;
     }
     
     ImGui::Spacing();
@@ -122,12 +170,12 @@ void UI::DrawMainMenu(SudokuGrid* grid)
     // Bouton Réinitialiser
     if (ImGui::Button("Reinitialiser", ImVec2(-1.0f, 40.0f)))
     {
-        grid->Clear();
-        grid->Initialize();
         mShowWinMessage = false;
-        ShowMessage("Reinitialise !");
+        action = MenuAction::ResetGrid;
     }
     
+    ImGui::EndDisabled();
+    
     ImGui::Spacing();
     ImGui::Separator();
     ImGui::Spacing();
@@ -159,6 +207,8 @@ void UI::DrawMainMenu(SudokuGrid* grid)
     ImGui::BulletText("Bleu = Tes chiffres");
     
     ImGui::End();
+    
+    return action;
 }
 
 // ============================================================================
@@ -228,6 +278,65 @@ void UI::DrawStatusBar(SudokuGrid* grid)
     ImGui::End();
 }
 
+// ============================================================================
+// Dessine l'overlay du profileur
+// ============================================================================
+void UI::DrawProfilerOverlay(const Profiler& profiler)
+{
+    ImGui::SetNextWindowPos(ImVec2(10.0f, 10.0f), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowBgAlpha(0.85f);
+    
+    ImGui::Begin("Profileur (F3)", nullptr,
+                 ImGuiWindowFlags_AlwaysAutoResize |
+                 ImGuiWindowFlags_NoFocusOnAppearing |
+                 ImGuiWindowFlags_NoNav);
+    
+    float frameAverage, frameP99;
+    profiler.GetFrameStats(&frameAverage, &frameP99);
+    
+    ImGui::Text("Frame : %.3f ms (p99 %.3f ms) sur %d frames",
+                frameAverage, frameP99, profiler.GetFrameCount());
+    
+    // Graphe des temps de frame
+    float history[Profiler::HISTORY_SIZE];
+    int count = profiler.GetFrameHistory(history);
+    if (count > 0)
+    {
+        ImGui::PlotLines("##FrameTimes", history, count, 0, nullptr,
+                         0.0f, frameP99 * 1.5f, ImVec2(320.0f, 60.0f));
+    }
+    
+    ImGui::Separator();
+    
+    // Tableau des étapes
+    if (ImGui::BeginTable("##Stages", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit))
+    {
+        ImGui::TableSetupColumn("Etape");
+        ImGui::TableSetupColumn("Moy (ms)");
+        ImGui::TableSetupColumn("p99 (ms)");
+        ImGui::TableHeadersRow();
+        
+        for (int i = 0; i < PROFILE_STAGE_COUNT; i++)
+        {
+            ProfileStage stage = static_cast<ProfileStage>(i);
+            float average, p99;
+            profiler.GetStageStats(stage, &average, &p99);
+            
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(Profiler::GetStageName(stage));
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", average);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", p99);
+        }
+        
+        ImGui::EndTable();
+    }
+    
+    ImGui::End();
+}
+
 // ============================================================================
 // Affiche un message temporaire
 // ============================================================================
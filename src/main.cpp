@@ -6,21 +6,106 @@
 // ============================================================================
 
 #include "../include/Game.h"
+#include "../include/Log.h"
+#include "../include/PuzzleGenerator.h"
+#include "../include/Trace.h"
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <string>
 
 int main(int argc, char* argv[])
 {
-    // Évite les warnings sur les paramètres inutilisés
-    (void)argc;
-    (void)argv;
+    // Options de la ligne de commande (mémorise aussi l'instant du lancement)
+    GameOptions options;
+    std::string tracePath;
+    
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--trace=", 8) == 0)
+        {
+            tracePath = argv[i] + 8;
+        }
+        else if (strcmp(argv[i], "--headless") == 0)
+        {
+            options.headless = true;
+        }
+        else if (strcmp(argv[i], "--no-splash") == 0)
+        {
+            options.showSplash = false;
+        }
+        else if (strcmp(argv[i], "--measure-startup") == 0)
+        {
+            options.measureStartup = true;
+        }
+        else if (strncmp(argv[i], "--frames=", 9) == 0)
+        {
+            options.headlessFrames = atoi(argv[i] + 9);
+        }
+        else if (strncmp(argv[i], "--puzzle-db=", 12) == 0)
+        {
+            options.puzzleDatabase = argv[i] + 12;
+            options.puzzleDatabaseExplicit = true;
+        }
+        else if (strncmp(argv[i], "--puzzle-ring=", 14) == 0)
+        {
+            options.puzzleRing = argv[i] + 14;
+        }
+        else if (strncmp(argv[i], "--puzzle=", 9) == 0)
+        {
+            options.puzzleNumber = strtoll(argv[i] + 9, nullptr, 10);
+            if (options.puzzleNumber < 0)
+            {
+                std::cerr << "Numero de grille invalide: " << argv[i] + 9 << std::endl;
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--daily") == 0 || strncmp(argv[i], "--daily=", 8) == 0)
+        {
+            const char* date = argv[i][7] == '=' ? argv[i] + 8 : "";
+            options.puzzleDay = PuzzleGenerator::DayNumber(date);
+            if (options.puzzleDay < 0)
+            {
+                std::cerr << "Date invalide (AAAA-MM-JJ): " << date << std::endl;
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--no-session") == 0)
+        {
+            options.useSession = false;
+        }
+        else if (strncmp(argv[i], "--session=", 10) == 0)
+        {
+            options.sessionFile = argv[i] + 10;
+        }
+        else
+        {
+            std::cerr << "Option inconnue: " << argv[i] << std::endl;
+            std::cerr << "Usage: " << argv[0]
+                      << " [--no-splash] [--measure-startup] [--trace=session.json]"
+                      << " [--headless [--frames=N]] [--puzzle-db=puzzles.db]"
+                      << " [--puzzle-ring=/sudoku-puzzles]"
+                      << " [--puzzle=N | --daily[=AAAA-MM-JJ]]"
+                      << " [--session=fichier | --no-session]" << std::endl;
+            std::cerr << "Base de grilles: sudoku-cli build-db --output=puzzles.db" << std::endl;
+            return 1;
+        }
+    }
+    
+    // Enregistrement de la session (ouvrir dans ui.perfetto.dev ou chrome://tracing)
+    if (!tracePath.empty() && !TraceRecorder::Start(tracePath))
+    {
+        return 1;
+    }
     
     // Création de l'instance du jeu
     Game game;
     
     // Initialisation du jeu
-    if (!game.Initialize())
+    if (!game.Initialize(options))
     {
         std::cerr << "Echec initialisation du jeu" << std::endl;
+        TraceRecorder::Stop();
         return 1;
     }
     
@@ -29,8 +114,10 @@ int main(int argc, char* argv[])
     
     // Fermeture propre
     game.Shutdown();
+    TraceRecorder::Stop();
     
-    std::cout << "Merci d'avoir joue !" << std::endl;
+    if (!options.headless)
+        std::cout << "Merci d'avoir joue !" << std::endl;
     
     return 0;
 }
\ No newline at end of file